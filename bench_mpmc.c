@@ -0,0 +1,115 @@
+/*******************************************************************************
+ *
+ * Copyright (C) 2026 by the ring buffer contributors
+ *
+ ******************************************************************************/
+
+/*
+ * @file bench_mpmc.c
+ * @brief Throughput benchmark for the MPMC ring as the number of producer and
+ *        consumer threads grows.
+ *
+ * @date October 16, 2026
+ *
+ * Usage: ./bench_mpmc [max_threads] [items] [ring_len]
+ * For each thread count n = 1, 2, 4, ... max_threads, runs n producers and n
+ * consumers moving items bytes in total and prints one CSV row.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include "ring_mpmc.h"
+
+#define DEFAULT_MAX_THREADS 8
+#define DEFAULT_ITEMS (1 << 22)
+#define DEFAULT_RING_LEN 1024
+#define SPINS_BEFORE_YIELD 64
+
+typedef struct
+{
+    mpmc_ring_t *ring;
+    int count;
+} worker_t;
+
+double now_sec()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+void *producer(void *arg)
+{
+    worker_t *w = arg;
+    for (int i = 0; i < w->count; i++)
+    {
+        int spins = 0;
+        while (!mpmc_insert(w->ring, (char)i))
+        {
+            if (++spins == SPINS_BEFORE_YIELD) { sched_yield(); spins = 0; }
+        }
+    }
+    return NULL;
+}
+
+void *consumer(void *arg)
+{
+    worker_t *w = arg;
+    char c;
+    for (int i = 0; i < w->count; i++)
+    {
+        int spins = 0;
+        while (!mpmc_remove(w->ring, &c))
+        {
+            if (++spins == SPINS_BEFORE_YIELD) { sched_yield(); spins = 0; }
+        }
+    }
+    return NULL;
+}
+
+// Run n producers and n consumers over one ring. Returns elapsed seconds.
+double run(int n, int items, int ring_len)
+{
+    mpmc_ring_t *ring = mpmc_init(ring_len);
+    pthread_t threads[2 * n];
+    worker_t workers[2 * n];
+
+    double start = now_sec();
+    for (int i = 0; i < 2 * n; i++)
+    {
+        workers[i].ring = ring;
+        workers[i].count = items / n;
+        pthread_create(&threads[i], NULL, (i < n) ? producer : consumer,
+                       &workers[i]);
+    }
+    for (int i = 0; i < 2 * n; i++)
+    {
+        pthread_join(threads[i], NULL);
+    }
+    double elapsed = now_sec() - start;
+
+    mpmc_clean(ring);
+    return elapsed;
+}
+
+int main(int argc, char *argv[])
+{
+    int max_threads = (argc > 1) ? atoi(argv[1]) : DEFAULT_MAX_THREADS;
+    int items = (argc > 2) ? atoi(argv[2]) : DEFAULT_ITEMS;
+    int ring_len = (argc > 3) ? atoi(argv[3]) : DEFAULT_RING_LEN;
+
+    printf("producers,consumers,items,ring_len,seconds,ns_per_item,"
+           "mitems_per_sec\n");
+    for (int n = 1; n <= max_threads; n *= 2)
+    {
+        int moved = (items / n) * n;
+        double sec = run(n, items, ring_len);
+        printf("%d,%d,%d,%d,%.6f,%.2f,%.2f\n", n, n, moved, ring_len, sec,
+               sec * 1e9 / moved, moved / sec / 1e6);
+    }
+
+    return (EXIT_SUCCESS);
+}
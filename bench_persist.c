@@ -0,0 +1,89 @@
+/*******************************************************************************
+ *
+ * Copyright (C) 2026 by the ring buffer contributors
+ *
+ ******************************************************************************/
+
+/*
+ * @file bench_persist.c
+ * @brief Throughput benchmark for the file-backed ring at different msync
+ *        intervals.
+ *
+ * @date October 16, 2026
+ *
+ * Usage: ./bench_persist [path] [megabytes] [ring_len]
+ * For each sync interval (never, then 1 MiB down to 4 KiB) streams megabytes
+ * through a ring stored at path and prints one CSV row. The file is removed
+ * afterwards.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "ring_file.h"
+
+#define DEFAULT_PATH "bench_persist.ring"
+#define DEFAULT_MEGABYTES 64
+#define DEFAULT_RING_LEN (1 << 20)
+#define CHUNK 4096
+
+static const size_t sync_intervals[] = {
+    0, 1 << 20, 256 << 10, 64 << 10, 16 << 10, 4 << 10
+};
+
+double now_sec()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Stream bytes through a fresh ring, keeping it about half full. Returns
+// elapsed seconds, or a negative value if the ring cannot be opened.
+double run(const char *path, size_t bytes, size_t ring_len, size_t sync_every)
+{
+    unlink(path);
+    file_ring_t *file = file_ring_open(path, ring_len, sync_every);
+    if (file == NULL) { return -1; }
+
+    char chunk[CHUNK];
+    memset(chunk, 'x', sizeof(chunk));
+    size_t backlog = ring_len / 2;
+
+    double start = now_sec();
+    for (size_t moved = 0; moved < bytes; )
+    {
+        moved += file_ring_insert_n(file, chunk, CHUNK);
+        if (pi_entries(file->Ring) > backlog)
+        {
+            file_ring_remove_n(file, chunk, CHUNK);
+        }
+    }
+    file_ring_sync(file);
+    double elapsed = now_sec() - start;
+
+    file_ring_close(file);
+    unlink(path);
+    return elapsed;
+}
+
+int main(int argc, char *argv[])
+{
+    const char *path = (argc > 1) ? argv[1] : DEFAULT_PATH;
+    size_t bytes = (size_t)((argc > 2) ? atoi(argv[2]) : DEFAULT_MEGABYTES)
+                   << 20;
+    size_t ring_len = (argc > 3) ? (size_t)atoi(argv[3]) : DEFAULT_RING_LEN;
+
+    printf("sync_every,bytes,ring_len,seconds,mb_per_sec\n");
+    for (size_t i = 0; i < sizeof(sync_intervals) / sizeof(size_t); i++)
+    {
+        double sec = run(path, bytes, ring_len, sync_intervals[i]);
+        if (sec < 0) { return (EXIT_FAILURE); }
+        printf("%zu,%zu,%zu,%.6f,%.2f\n", sync_intervals[i], bytes, ring_len,
+               sec, bytes / sec / (1 << 20));
+    }
+
+    return (EXIT_SUCCESS);
+}
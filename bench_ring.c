@@ -0,0 +1,408 @@
+/*******************************************************************************
+ *
+ * Copyright (C) 2026 by the ring buffer contributors
+ *
+ ******************************************************************************/
+
+/*
+ * @file bench_ring.c
+ * @brief Throughput and latency benchmarks for the SPSC ring in ring.c.
+ *
+ * @date October 16, 2026
+ *
+ * Usage: ./bench_ring [-j] [-b baseline] [ops]
+ * For each ring length from 4 to 1M measures, in ns per call:
+ *   insert, my_remove      one byte per call, filling then draining the ring
+ *   insert_n, remove_n     half a ring per call
+ *   spsc_stream            insert_n/remove_n of 64 bytes between two threads
+ * and once, with a ring of PING_RING_LEN:
+ *   pingpong_1t            insert then my_remove of one byte in one thread
+ *   pingpong_2t            one-way latency of a byte bounced between threads
+ * ops (default 4M) is the number of bytes moved per row, except for
+ * pingpong_2t, which makes PING_ROUNDS round trips. Short rings are
+ * filled in batches of several rings so the clock is read only a few times
+ * per row.
+ *
+ * Prints CSV, or JSON with -j. With -b, or the BENCH_BASELINE environment
+ * variable, also prints each row's ns_per_op from an earlier run (CSV or
+ * JSON) and the change in percent. If BENCH_MAX_REGRESSION is set, exits
+ * with status 2 when any row is slower than its baseline by more than that
+ * many percent. From make: make bench saves a run to bench.csv; to compare
+ * a change, cp bench.csv before.csv, rebuild, then
+ * make bench BASELINE=before.csv.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include <unistd.h>
+#include "ring.h"
+
+#define DEFAULT_OPS (1 << 22)
+#define MIN_RING_LEN 4
+#define MAX_RING_LEN (1 << 20)
+#define BATCH_BYTES 4096 // rings per batch = BATCH_BYTES / ring_len
+#define STREAM_MIN_LEN 64
+#define STREAM_CHUNK 64
+#define PING_RING_LEN 64
+#define PING_ROUNDS (1 << 16)
+#define SPINS_BEFORE_YIELD 64
+#define MAX_ROWS 128
+#define NAME_LEN 32
+
+typedef struct
+{
+    char bench[NAME_LEN];
+    size_t ring_len;
+    size_t chunk;
+    size_t ops;
+    double ns_per_op;
+} row_t;
+
+typedef struct
+{
+    ring_t *ring;
+    ring_t *back; // pingpong_2t only
+    size_t bytes;
+} worker_t;
+
+row_t rows[MAX_ROWS];
+int num_rows;
+row_t baseline[MAX_ROWS];
+int num_baseline;
+
+double now_sec()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+void add_row(const char *bench, size_t ring_len, size_t chunk, size_t ops,
+             double sec)
+{
+    if (num_rows == MAX_ROWS) { return; }
+    row_t *r = &rows[num_rows++];
+    snprintf(r->bench, sizeof(r->bench), "%s", bench);
+    r->ring_len = ring_len;
+    r->chunk = chunk;
+    r->ops = ops;
+    r->ns_per_op = sec * 1e9 / ops;
+}
+
+// Bail out if a ring call moved fewer bytes than it should have; the
+// numbers would be meaningless.
+void check(int ok, const char *bench)
+{
+    if (!ok)
+    {
+        fprintf(stderr, "bench_ring: %s: short insert or remove\n", bench);
+        exit(EXIT_FAILURE);
+    }
+}
+
+// Fill and drain batches of rings of ring_len, one byte per call, then
+// chunk bytes per call.
+void bench_single(size_t ring_len, size_t ops)
+{
+    size_t num_rings = (ring_len < BATCH_BYTES) ? BATCH_BYTES / ring_len : 1;
+    size_t reps = ops / (num_rings * ring_len);
+    if (reps == 0) { reps = 1; }
+    size_t moved = reps * num_rings * ring_len;
+    size_t chunk = ring_len / 2;
+
+    ring_t *rings[num_rings];
+    for (size_t k = 0; k < num_rings; k++) { rings[k] = init(ring_len); }
+    char *buf = malloc(chunk);
+    memset(buf, 'x', chunk);
+
+    double ins = 0, rem = 0;
+    int ok = 1;
+    for (size_t r = 0; r < reps; r++)
+    {
+        double t0 = now_sec();
+        for (size_t k = 0; k < num_rings; k++)
+        {
+            for (size_t i = 0; i < ring_len; i++)
+            {
+                ok &= insert(rings[k], (char)i);
+            }
+        }
+        double t1 = now_sec();
+        char c;
+        for (size_t k = 0; k < num_rings; k++)
+        {
+            for (size_t i = 0; i < ring_len; i++)
+            {
+                ok &= my_remove(rings[k], &c);
+            }
+        }
+        double t2 = now_sec();
+        ins += t1 - t0;
+        rem += t2 - t1;
+    }
+    check(ok, "insert/my_remove");
+    add_row("insert", ring_len, 1, moved, ins);
+    add_row("my_remove", ring_len, 1, moved, rem);
+
+    ins = rem = 0;
+    for (size_t r = 0; r < reps; r++)
+    {
+        double t0 = now_sec();
+        for (size_t k = 0; k < num_rings; k++)
+        {
+            ok &= (insert_n(rings[k], buf, chunk) == chunk);
+            ok &= (insert_n(rings[k], buf, chunk) == chunk);
+        }
+        double t1 = now_sec();
+        for (size_t k = 0; k < num_rings; k++)
+        {
+            ok &= (remove_n(rings[k], buf, chunk) == chunk);
+            ok &= (remove_n(rings[k], buf, chunk) == chunk);
+        }
+        double t2 = now_sec();
+        ins += t1 - t0;
+        rem += t2 - t1;
+    }
+    check(ok, "insert_n/remove_n");
+    add_row("insert_n", ring_len, chunk, moved / chunk, ins);
+    add_row("remove_n", ring_len, chunk, moved / chunk, rem);
+
+    free(buf);
+    for (size_t k = 0; k < num_rings; k++) { clean(rings[k]); }
+}
+
+void *stream_producer(void *arg)
+{
+    worker_t *w = arg;
+    char buf[STREAM_CHUNK];
+    memset(buf, 'x', sizeof(buf));
+    for (size_t sent = 0; sent < w->bytes; )
+    {
+        size_t n = insert_n(w->ring, buf, sizeof(buf));
+        if (n == 0) { sched_yield(); }
+        sent += n;
+    }
+    return NULL;
+}
+
+// Stream ops bytes from a second thread through a ring of ring_len.
+void bench_stream(size_t ring_len, size_t ops)
+{
+    ring_t *ring = init(ring_len);
+    worker_t w = { ring, NULL, ops };
+    char buf[STREAM_CHUNK];
+    pthread_t producer;
+
+    double start = now_sec();
+    pthread_create(&producer, NULL, stream_producer, &w);
+    for (size_t got = 0; got < ops; )
+    {
+        size_t n = remove_n(ring, buf, sizeof(buf));
+        if (n == 0) { sched_yield(); }
+        got += n;
+    }
+    pthread_join(producer, NULL);
+    double elapsed = now_sec() - start;
+
+    add_row("spsc_stream", ring_len, STREAM_CHUNK, ops / STREAM_CHUNK,
+            elapsed);
+    clean(ring);
+}
+
+// Wait for a byte, spinning for a while before giving up the CPU.
+void recv_byte(ring_t *ring, char *c)
+{
+    int spins = 0;
+    while (!my_remove(ring, c))
+    {
+        if (++spins == SPINS_BEFORE_YIELD) { sched_yield(); spins = 0; }
+    }
+}
+
+void *ping_echo(void *arg)
+{
+    worker_t *w = arg;
+    char c;
+    for (size_t i = 0; i < w->bytes; i++)
+    {
+        recv_byte(w->ring, &c);
+        insert(w->back, c);
+    }
+    return NULL;
+}
+
+// Latency of one byte through a ring, in one thread and between two.
+void bench_pingpong(size_t ops)
+{
+    ring_t *ring = init(PING_RING_LEN);
+    ring_t *back = init(PING_RING_LEN);
+    char c;
+    int ok = 1;
+
+    double start = now_sec();
+    for (size_t i = 0; i < ops; i++)
+    {
+        ok &= insert(ring, (char)i);
+        ok &= my_remove(ring, &c);
+    }
+    add_row("pingpong_1t", PING_RING_LEN, 1, ops, now_sec() - start);
+    check(ok, "pingpong_1t");
+
+    // Each round trip is two one-way trips.
+    worker_t w = { ring, back, PING_ROUNDS };
+    pthread_t echo;
+    pthread_create(&echo, NULL, ping_echo, &w);
+    start = now_sec();
+    for (size_t i = 0; i < PING_ROUNDS; i++)
+    {
+        insert(ring, (char)i);
+        recv_byte(back, &c);
+    }
+    double elapsed = now_sec() - start;
+    pthread_join(echo, NULL);
+    add_row("pingpong_2t", PING_RING_LEN, 1, 2 * PING_ROUNDS, elapsed);
+
+    clean(ring);
+    clean(back);
+}
+
+// Read rows printed by an earlier run, as CSV or JSON. Returns 0 on
+// success.
+int load_baseline(const char *path)
+{
+    FILE *f = fopen(path, "r");
+    if (f == NULL)
+    {
+        fprintf(stderr, "bench_ring: cannot open baseline %s\n", path);
+        return -1;
+    }
+
+    char line[256];
+    while (num_baseline < MAX_ROWS && fgets(line, sizeof(line), f) != NULL)
+    {
+        row_t *r = &baseline[num_baseline];
+        const char *p = strchr(line, '{');
+        int n = (p != NULL)
+                ? sscanf(p, "{\"bench\": \"%31[^\"]\", \"ring_len\": %zu, "
+                         "\"chunk\": %zu, \"ops\": %zu, \"ns_per_op\": %lf",
+                         r->bench, &r->ring_len, &r->chunk, &r->ops,
+                         &r->ns_per_op)
+                : sscanf(line, "%31[^,],%zu,%zu,%zu,%lf", r->bench,
+                         &r->ring_len, &r->chunk, &r->ops, &r->ns_per_op);
+        if (n == 5) { num_baseline++; } // skips the CSV header
+    }
+    fclose(f);
+    return 0;
+}
+
+// The baseline row for r, or NULL.
+row_t *find_baseline(row_t *r)
+{
+    for (int i = 0; i < num_baseline; i++)
+    {
+        row_t *b = &baseline[i];
+        if (strcmp(b->bench, r->bench) == 0 && b->ring_len == r->ring_len &&
+            b->chunk == r->chunk)
+        {
+            return b;
+        }
+    }
+    return NULL;
+}
+
+// Print all rows. Returns the largest slowdown against the baseline, in
+// percent.
+double print_rows(int json)
+{
+    double worst = 0;
+    if (json) { printf("[\n"); }
+    else
+    {
+        printf("bench,ring_len,chunk,ops,ns_per_op,mb_per_sec%s\n",
+               num_baseline ? ",baseline_ns_per_op,change_pct" : "");
+    }
+
+    for (int i = 0; i < num_rows; i++)
+    {
+        row_t *r = &rows[i];
+        double mb_per_sec = r->chunk * 1e9 / r->ns_per_op / (1 << 20);
+        if (json)
+        {
+            printf("  {\"bench\": \"%s\", \"ring_len\": %zu, \"chunk\": %zu, "
+                   "\"ops\": %zu, \"ns_per_op\": %.3f, \"mb_per_sec\": %.2f",
+                   r->bench, r->ring_len, r->chunk, r->ops, r->ns_per_op,
+                   mb_per_sec);
+        }
+        else
+        {
+            printf("%s,%zu,%zu,%zu,%.3f,%.2f", r->bench, r->ring_len,
+                   r->chunk, r->ops, r->ns_per_op, mb_per_sec);
+        }
+
+        row_t *b = num_baseline ? find_baseline(r) : NULL;
+        if (b != NULL)
+        {
+            double change = (r->ns_per_op / b->ns_per_op - 1) * 100;
+            if (change > worst) { worst = change; }
+            printf(json ? ", \"baseline_ns_per_op\": %.3f, "
+                          "\"change_pct\": %.1f" : ",%.3f,%.1f",
+                   b->ns_per_op, change);
+        }
+        else if (num_baseline && !json)
+        {
+            printf(",,");
+        }
+        printf(json ? "}%s\n" : "\n", (i + 1 < num_rows) ? "," : "");
+    }
+
+    if (json) { printf("]\n"); }
+    return worst;
+}
+
+int main(int argc, char *argv[])
+{
+    int json = 0;
+    const char *base = getenv("BENCH_BASELINE");
+    int opt;
+    while ((opt = getopt(argc, argv, "jb:")) != -1)
+    {
+        switch (opt)
+        {
+        case 'j': json = 1; break;
+        case 'b': base = optarg; break;
+        default:
+            fprintf(stderr, "Usage: %s [-j] [-b baseline] [ops]\n", argv[0]);
+            return (EXIT_FAILURE);
+        }
+    }
+    size_t ops = (optind < argc) ? (size_t)atol(argv[optind]) : DEFAULT_OPS;
+    if (ops < STREAM_CHUNK) { ops = STREAM_CHUNK; }
+    if (base != NULL && base[0] != '\0' && load_baseline(base) != 0)
+    {
+        return (EXIT_FAILURE);
+    }
+
+    for (size_t len = MIN_RING_LEN; len <= MAX_RING_LEN; len *= 4)
+    {
+        bench_single(len, ops);
+    }
+    for (size_t len = STREAM_MIN_LEN; len <= MAX_RING_LEN; len *= 4)
+    {
+        bench_stream(len, ops);
+    }
+    bench_pingpong(ops);
+
+    double worst = print_rows(json);
+    const char *max = getenv("BENCH_MAX_REGRESSION");
+    if (num_baseline && max != NULL && worst > atof(max))
+    {
+        fprintf(stderr, "bench_ring: %.1f%% slower than baseline\n", worst);
+        return 2;
+    }
+
+    return (EXIT_SUCCESS);
+}
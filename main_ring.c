@@ -16,6 +16,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "ring.h"
+#include "ring_trace.h"
+#include "ring_stats.h"
 
 #define MAX_NUM_RINGS 3 
 #define NUM_ITERATIONS 3
@@ -31,7 +33,7 @@ void transmit(ring_t *ring)
     {
         // Insert data.
         insert(ring, ASCII_START_NUM + i);
-        printf("Num entries at iteration=%d are: %d\n", i, entries(ring));
+        printf("Num entries at iteration=%d are: %zu\n", i, entries(ring));
         show(ring);
     }
 }
@@ -42,7 +44,7 @@ void receive(ring_t *ring)
     {
         char c;
         my_remove(ring, &c);
-        printf("Num entries at iteration=%d are: %d\n", i, entries(ring));
+        printf("Num entries at iteration=%d are: %zu\n", i, entries(ring));
         show(ring);
     }
 }
@@ -55,6 +57,7 @@ int main(void)
 
         // Initialize ring.
         ring[i] = init(ring_length[i]);
+        ring_stats_enable(ring[i]);
 
         // Transmit data.
         transmit(ring[i]);
@@ -62,6 +65,12 @@ int main(void)
         // Receive data (i.e. remove data).
         receive(ring[i]);
 
+        // Show what the ring recorded (only with TRACE_LEVEL > 0).
+        ring_trace_dump();
+
+        // Show how full the ring got and what failed.
+        ring_stats_show(ring[i]);
+
         // Clean ring.
         clean(ring[i]);
     }
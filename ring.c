@@ -17,10 +17,11 @@
  */
 
 #include "ring.h"
+#include "ring_trace.h"
+#include "ring_stats.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <math.h>
 
 #define MSG_EMPTY_RING "ERROR: Ring is NULL.\n"
 #define MSG_EMPTY_RING_BUFFER "ERROR: Ring buffer is NULL.\n"
@@ -45,7 +46,7 @@ int is_ring_buffer_valid(ring_t *ring)
     return 1;
 }
 
-ring_t* init(int length)
+ring_t* init(size_t length)
 {
     // Confirm length is a power of 2.
     if (!((length != 0) && !(length & (length - 1))))
@@ -54,8 +55,9 @@ ring_t* init(int length)
         exit(EXIT_FAILURE);
     }
 
-    // Alloc and verify ring.
-    ring_t *ring = malloc(sizeof(ring_t));
+    // Alloc and verify ring. Aligned so the producer and consumer indices
+    // land on their own cache lines.
+    ring_t *ring = aligned_alloc(RING_CACHE_LINE, sizeof(ring_t));
     if (!is_ring_valid(ring)) { exit(EXIT_FAILURE); }
 
     // Alloc and verify ring buffer.
@@ -63,34 +65,86 @@ ring_t* init(int length)
     if (!is_ring_buffer_valid(ring)) { exit(EXIT_FAILURE); }
 
     // Set ring parameters.
-    ring->Length = length;
-    ring->Ini = 0;
-    ring->Outi = 0;
-    ring->Adj_Len = (1 << (int)(log(length)/log(2))) - 1;
+    ring_init_fields(ring, ring->Buffer, length, 0);
 
     // Return ring.
     return ring;
 }
 
+// Set up an empty ring over buffer, which holds length chars (a power of 2),
+// with no hooks, stats or policy. Shared by init() and the other ring
+// constructors so every field starts out the same.
+void ring_init_fields(ring_t *ring, char *buffer, size_t length, int flags)
+{
+    ring->Buffer = buffer;
+    ring->Length = length;
+    ring->Adj_Len = length - 1;
+    ring->Flags = flags;
+    ring->On_Insert = NULL;
+    ring->On_Remove = NULL;
+    ring->Notify_Ctx = NULL;
+    ring->Stats = NULL;
+    ring->Grow_Max = 0;
+    ring->Grow_Min = 0;
+    ring->Shrink_Pct = 0;
+    atomic_init(&ring->Ini, 0);
+    atomic_init(&ring->Outi, 0);
+    atomic_init(&ring->Overwritten, 0);
+    ring->Outi_Cache = 0;
+    ring->Ini_Cache = 0;
+}
+
+// Auto-grow: resize so at least n more bytes fit, up to Grow_Max. Returns the
+// free space afterwards.
+static size_t auto_grow(ring_t *ring, size_t n)
+{
+    size_t used = entries(ring);
+    size_t length = ring->Length;
+    while (length - used < n && length < ring->Grow_Max) { length <<= 1; }
+    if (length != ring->Length) { ring_resize(ring, length); }
+    return ring->Length - used;
+}
+
+// Auto-shrink: halve the ring while it is at most Shrink_Pct % full, down to
+// Grow_Min. Shrink_Pct is below 50, so a shrunk ring is never left full; 0
+// never shrinks, even when the ring is empty.
+static void auto_shrink(ring_t *ring)
+{
+    if (ring->Shrink_Pct == 0) { return; }
+
+    size_t used = entries(ring);
+    size_t length = ring->Length;
+    while (length > ring->Grow_Min &&
+           used * 100 <= (size_t)ring->Shrink_Pct * length)
+    {
+        length >>= 1;
+    }
+    if (length != ring->Length) { ring_resize(ring, length); }
+}
+
 int insert(ring_t *ring, char data)
 {
     // Verify.
     if (!is_ring_valid(ring) || !is_ring_buffer_valid(ring))
     { exit(EXIT_FAILURE); }
 
-    // Insert.
-    if ((ring->Ini - ring->Outi) < ring->Length)
+    // Insert, growing the ring first if it is full.
+    if ((ring->Flags & RING_F_GROW) && entries(ring) == ring->Length)
     {
-        ring->Buffer[ring->Ini++ & ring->Adj_Len] = data;
-
-        printf("insert(): Inserted char=%c, Ini=%d\n", data, ring->Ini);
-        return 1;
+        auto_grow(ring, 1);
     }
-    else
+    if (ring_insert(ring, data))
     {
-        printf("insert(): ERROR: Cannot insert. Buffer is full.\n");
+        RING_TRACE(RING_EV_INSERT,
+                   atomic_load_explicit(&ring->Ini, memory_order_relaxed),
+                   data);
+        return 1;
     }
 
+    // Buffer is full.
+    RING_TRACE_ERR(RING_EV_FULL,
+                   atomic_load_explicit(&ring->Ini, memory_order_relaxed),
+                   data);
     return 0;
 }
 
@@ -101,26 +155,436 @@ int my_remove(ring_t *ring, char *data)
     { exit(EXIT_FAILURE); }
 
     // Remove.
-    if (ring->Outi != ring->Ini)
+    if (ring_remove(ring, data))
     {
-        *data = ring->Buffer[ring->Outi++ & ring->Adj_Len];
-        printf("my_remove(): Removed char=%c, Outi=%d\n", *data, ring->Outi);
+        RING_TRACE(RING_EV_REMOVE,
+                   atomic_load_explicit(&ring->Outi, memory_order_relaxed),
+                   *data);
+        if (ring->Flags & RING_F_GROW) { auto_shrink(ring); }
         return 1;
     }
+
+    // Buffer is empty.
+    RING_TRACE_ERR(RING_EV_EMPTY,
+                   atomic_load_explicit(&ring->Outi, memory_order_relaxed),
+                   0);
+    return 0;
+}
+
+// Lock-free single-producer insert. No validation or printing; only the
+// producer may call this.
+int ring_insert(ring_t *ring, char data)
+{
+    return ring_insert_fixed(ring, data, ring->Length);
+}
+
+// Lock-free single-consumer remove. No validation or printing; only the
+// consumer may call this.
+int ring_remove(ring_t *ring, char *data)
+{
+    return ring_remove_fixed(ring, data, ring->Length);
+}
+
+// Number of bytes that can be accessed contiguously from slot start. A
+// mirrored ring maps its buffer twice back to back, so a full Length is always
+// contiguous.
+static size_t to_wrap(ring_t *ring, size_t start)
+{
+    if (ring->Flags & RING_F_MIRRORED) { return ring->Length; }
+    return ring->Length - start;
+}
+
+// Insert up to n bytes from src with at most two copies (before and after the
+// wrap point) and a single publish of Ini. Returns the number of bytes
+// inserted, which is less than n if the ring fills up.
+size_t insert_n(ring_t *ring, const char *src, size_t n)
+{
+    // Verify.
+    if (!is_ring_valid(ring) || !is_ring_buffer_valid(ring))
+    { exit(EXIT_FAILURE); }
+
+    size_t ini = atomic_load_explicit(&ring->Ini, memory_order_relaxed);
+
+    // Only reload Outi when the cached copy does not leave enough room.
+    size_t space = ring->Length - (ini - ring->Outi_Cache);
+    if (space < n)
+    {
+        ring->Outi_Cache = atomic_load_explicit(&ring->Outi,
+                                                memory_order_acquire);
+        space = ring->Length - (ini - ring->Outi_Cache);
+    }
+
+    // Grow the ring if n does not fit, as far as Grow_Max allows.
+    if (space < n && (ring->Flags & RING_F_GROW))
+    {
+        space = auto_grow(ring, n);
+        ini = atomic_load_explicit(&ring->Ini, memory_order_relaxed);
+    }
+
+    // In overwrite mode make room by dropping the oldest entries. Only the
+    // last Length bytes of src can survive.
+    if (space < n && (ring->Flags & RING_F_OVERWRITE))
+    {
+        if (n > ring->Length)
+        {
+            size_t skipped = n - ring->Length;
+            size_t dropped = atomic_load_explicit(&ring->Overwritten,
+                                               memory_order_relaxed);
+            atomic_store_explicit(&ring->Overwritten, dropped + skipped,
+                                  memory_order_relaxed);
+            src += skipped;
+            n = ring->Length;
+        }
+        ring_overwrite_oldest(ring, ini, n);
+        space = n;
+    }
+
+    if (n > space) { n = space; }
+    if (n == 0)
+    {
+        ring_notify_insert(ring, 0);
+        return 0;
+    }
+
+    // Copy up to the end of the buffer, then the rest from the start. In
+    // overwrite mode the consumer may be reading these slots.
+    size_t start = ini & ring->Adj_Len;
+    size_t first = to_wrap(ring, start);
+    if (first > n) { first = n; }
+    if (ring->Flags & RING_F_OVERWRITE)
+    {
+        ring_store_bytes(ring->Buffer + start, src, first);
+        ring_store_bytes(ring->Buffer, src + first, n - first);
+    }
     else
     {
-        printf("my_remove(): ERROR: Cannot remove. Buffer is empty.\n");
+        memcpy(ring->Buffer + start, src, first);
+        memcpy(ring->Buffer, src + first, n - first);
     }
 
-    return 0;
+    atomic_store_explicit(&ring->Ini, ini + n, memory_order_release);
+    ring_notify_insert(ring, n);
+    return n;
 }
 
-int entries(ring_t *ring)
+// remove_n() for overwrite mode. Copies the bytes, then claims them with a CAS
+// on Outi; if the producer dropped any of them in the meantime the copy is
+// stale and is redone from the new Outi.
+static size_t remove_n_cas(ring_t *ring, char *dst, size_t n)
+{
+    size_t outi = atomic_load_explicit(&ring->Outi, memory_order_acquire);
+    for (;;)
+    {
+        size_t ini = atomic_load_explicit(&ring->Ini, memory_order_acquire);
+        size_t count = (n < ini - outi) ? n : ini - outi;
+        if (count == 0)
+        {
+            ring_notify_remove(ring, 0);
+            return 0;
+        }
+
+        size_t start = outi & ring->Adj_Len;
+        size_t first = to_wrap(ring, start);
+        if (first > count) { first = count; }
+        ring_load_bytes(dst, ring->Buffer + start, first);
+        ring_load_bytes(dst + first, ring->Buffer, count - first);
+
+        if (atomic_compare_exchange_weak_explicit(&ring->Outi, &outi,
+                outi + count, memory_order_acq_rel, memory_order_acquire))
+        {
+            ring_notify_remove(ring, count);
+            return count;
+        }
+    }
+}
+
+// Remove up to n bytes into dst with at most two copies and a single publish
+// of Outi. Returns the number of bytes removed, which is less than n if the
+// ring runs empty.
+size_t remove_n(ring_t *ring, char *dst, size_t n)
+{
+    // Verify.
+    if (!is_ring_valid(ring) || !is_ring_buffer_valid(ring))
+    { exit(EXIT_FAILURE); }
+
+    // The producer may also move Outi in overwrite mode.
+    if (ring->Flags & RING_F_OVERWRITE) { return remove_n_cas(ring, dst, n); }
+
+    size_t outi = atomic_load_explicit(&ring->Outi, memory_order_relaxed);
+
+    // Only reload Ini when the cached copy does not hold enough bytes.
+    size_t avail = ring->Ini_Cache - outi;
+    if (avail < n)
+    {
+        ring->Ini_Cache = atomic_load_explicit(&ring->Ini,
+                                               memory_order_acquire);
+        avail = ring->Ini_Cache - outi;
+    }
+    if (n > avail) { n = avail; }
+    if (n == 0)
+    {
+        ring_notify_remove(ring, 0);
+        return 0;
+    }
+
+    // Copy up to the end of the buffer, then the rest from the start.
+    size_t start = outi & ring->Adj_Len;
+    size_t first = to_wrap(ring, start);
+    if (first > n) { first = n; }
+    memcpy(dst, ring->Buffer + start, first);
+    memcpy(dst + first, ring->Buffer, n - first);
+
+    atomic_store_explicit(&ring->Outi, outi + n, memory_order_release);
+    ring_notify_remove(ring, n);
+    if (ring->Flags & RING_F_GROW) { auto_shrink(ring); }
+    return n;
+}
+
+// Get a contiguous writable span of up to max bytes starting at Ini. The span
+// stops at the wrap point (unless the ring is mirrored), so it may be shorter
+// than the free space. Returns
+// its length and points *ptr at it; the bytes are not visible to the consumer
+// until ring_commit().
+size_t ring_reserve(ring_t *ring, size_t max, char **ptr)
+{
+    // Verify.
+    if (!is_ring_valid(ring) || !is_ring_buffer_valid(ring))
+    { exit(EXIT_FAILURE); }
+
+    size_t ini = atomic_load_explicit(&ring->Ini, memory_order_relaxed);
+    size_t start = ini & ring->Adj_Len;
+    size_t contig = to_wrap(ring, start);
+
+    // Only reload Outi when the cached copy limits the span below max.
+    size_t space = ring->Length - (ini - ring->Outi_Cache);
+    if (space < max && space < contig)
+    {
+        ring->Outi_Cache = atomic_load_explicit(&ring->Outi,
+                                                memory_order_acquire);
+        space = ring->Length - (ini - ring->Outi_Cache);
+    }
+
+    size_t span = (space < contig) ? space : contig;
+    if (span > max) { span = max; }
+
+    *ptr = ring->Buffer + start;
+    return span;
+}
+
+// Publish n bytes written into the span from ring_reserve(). n must not be
+// larger than that span.
+void ring_commit(ring_t *ring, size_t n)
+{
+    size_t ini = atomic_load_explicit(&ring->Ini, memory_order_relaxed);
+    atomic_store_explicit(&ring->Ini, ini + n, memory_order_release);
+    if (n) { ring_notify_insert(ring, n); }
+}
+
+// Get the longest contiguous readable span starting at Outi. The span stops
+// at the wrap point (unless the ring is mirrored), so it may be shorter than
+// entries(). Returns its length
+// and points *ptr at it; the bytes stay in the ring until ring_consume().
+size_t ring_peek(ring_t *ring, char **ptr)
+{
+    // Verify.
+    if (!is_ring_valid(ring) || !is_ring_buffer_valid(ring))
+    { exit(EXIT_FAILURE); }
+
+    size_t outi = atomic_load_explicit(&ring->Outi, memory_order_relaxed);
+    size_t start = outi & ring->Adj_Len;
+    size_t contig = to_wrap(ring, start);
+
+    // Only reload Ini when the cached copy ends before the wrap point.
+    size_t avail = ring->Ini_Cache - outi;
+    if (avail < contig)
+    {
+        ring->Ini_Cache = atomic_load_explicit(&ring->Ini,
+                                               memory_order_acquire);
+        avail = ring->Ini_Cache - outi;
+    }
+
+    *ptr = ring->Buffer + start;
+    return (avail < contig) ? avail : contig;
+}
+
+// Release n bytes read through ring_peek() back to the producer. n must not be
+// larger than that span.
+void ring_consume(ring_t *ring, size_t n)
+{
+    size_t outi = atomic_load_explicit(&ring->Outi, memory_order_relaxed);
+    atomic_store_explicit(&ring->Outi, outi + n, memory_order_release);
+    if (n) { ring_notify_remove(ring, n); }
+}
+
+// Turn overwrite mode on or off. Set it before the ring is shared.
+void ring_set_overwrite(ring_t *ring, int enable)
 {
     // Verify.
     if (!is_ring_valid(ring)) { exit(EXIT_FAILURE); }
 
-    return (ring->Ini - ring->Outi);
+    if (enable) { ring->Flags |= RING_F_OVERWRITE; }
+    else { ring->Flags &= ~RING_F_OVERWRITE; }
+}
+
+// Number of entries dropped by overwrite mode so far.
+size_t ring_overwritten(ring_t *ring)
+{
+    // Verify.
+    if (!is_ring_valid(ring)) { exit(EXIT_FAILURE); }
+
+    return atomic_load_explicit(&ring->Overwritten, memory_order_relaxed);
+}
+
+// Producer side of overwrite mode: advance Outi so n entries fit at ini,
+// dropping the oldest ones. The consumer may advance Outi at the same time,
+// so this only moves it forward with a CAS and counts what it dropped.
+void ring_overwrite_oldest(ring_t *ring, size_t ini, size_t n)
+{
+    size_t need = ini + n - ring->Length; // Outi must reach at least this
+    size_t outi = atomic_load_explicit(&ring->Outi, memory_order_acquire);
+
+    // Outi is behind need when need - outi is 1..Length; any larger value
+    // means the consumer has already moved past it.
+    while (need != outi && (need - outi) <= ring->Length)
+    {
+        if (atomic_compare_exchange_weak_explicit(&ring->Outi, &outi, need,
+                memory_order_acq_rel, memory_order_acquire))
+        {
+            size_t dropped = atomic_load_explicit(&ring->Overwritten,
+                                               memory_order_relaxed);
+            atomic_store_explicit(&ring->Overwritten, dropped + need - outi,
+                                  memory_order_relaxed);
+            outi = need;
+        }
+    }
+
+    ring->Outi_Cache = outi;
+}
+
+// Consumer side of overwrite mode: read the oldest byte, then claim it with a
+// CAS on Outi. If the producer dropped it in the meantime the read is stale
+// and is redone from the new Outi.
+int ring_remove_cas(ring_t *ring, char *data)
+{
+    size_t outi = atomic_load_explicit(&ring->Outi, memory_order_acquire);
+    for (;;)
+    {
+        size_t ini = atomic_load_explicit(&ring->Ini, memory_order_acquire);
+        if (outi == ini)
+        {
+            ring_notify_remove(ring, 0);
+            return 0;
+        }
+
+        char c;
+        ring_load_bytes(&c, ring->Buffer + (outi & ring->Adj_Len), 1);
+        if (atomic_compare_exchange_weak_explicit(&ring->Outi, &outi,
+                outi + 1, memory_order_acq_rel, memory_order_acquire))
+        {
+            *data = c;
+            ring_notify_remove(ring, 1);
+            return 1;
+        }
+    }
+}
+
+// Move the ring into a new buffer of length chars (a power of 2), copying the
+// live bytes to its start with at most two copies. Only for heap rings, and
+// only while no other thread uses the ring. Returns 1 on success, 0 if the
+// live bytes do not fit or the buffer cannot be allocated.
+int ring_resize(ring_t *ring, size_t length)
+{
+    // Verify.
+    if (!is_ring_valid(ring) || !is_ring_buffer_valid(ring))
+    { exit(EXIT_FAILURE); }
+
+    // Confirm length is a power of 2.
+    if (!((length != 0) && !(length & (length - 1))))
+    {
+        printf("ring_resize(): ERROR: Length of ring must be a power of 2.\n");
+        exit(EXIT_FAILURE);
+    }
+    if (ring->Flags & (RING_F_STATIC | RING_F_MIRRORED | RING_F_ARENA))
+    {
+        printf("ring_resize(): ERROR: Only heap rings can be resized.\n");
+        return 0;
+    }
+
+    size_t outi = atomic_load_explicit(&ring->Outi, memory_order_relaxed);
+    size_t ini = atomic_load_explicit(&ring->Ini, memory_order_relaxed);
+    size_t live = ini - outi;
+    if (live > length) { return 0; }
+
+    char *buffer = malloc(length * sizeof(char));
+    if (buffer == NULL) { return 0; }
+
+    // Latency stamps are keyed by index, so they move with Outi.
+    if (!ring_stats_resize(ring, length))
+    {
+        free(buffer);
+        return 0;
+    }
+
+    // Copy up to the end of the old buffer, then the rest from its start.
+    size_t start = outi & ring->Adj_Len;
+    size_t first = ring->Length - start;
+    if (first > live) { first = live; }
+    memcpy(buffer, ring->Buffer + start, first);
+    memcpy(buffer + first, ring->Buffer, live - first);
+
+    free(ring->Buffer);
+    ring->Buffer = buffer;
+    ring->Length = length;
+    ring->Adj_Len = length - 1;
+    atomic_store_explicit(&ring->Outi, 0, memory_order_relaxed);
+    atomic_store_explicit(&ring->Ini, live, memory_order_relaxed);
+    ring->Outi_Cache = 0;
+    ring->Ini_Cache = live;
+    return 1;
+}
+
+// Let insert()/insert_n() double the ring up to max_length when it is full,
+// and my_remove()/remove_n() halve it back, down to its current length, when
+// it is at most shrink_pct % full (below 50; 0 never shrinks). A max_length of
+// 0 turns auto-grow off. Only for heap rings owned by one thread.
+void ring_set_autogrow(ring_t *ring, size_t max_length, unsigned shrink_pct)
+{
+    // Verify.
+    if (!is_ring_valid(ring)) { exit(EXIT_FAILURE); }
+
+    if (max_length == 0)
+    {
+        ring->Flags &= ~RING_F_GROW;
+        return;
+    }
+    if ((max_length & (max_length - 1)) || max_length < ring->Length ||
+        shrink_pct >= 50)
+    {
+        printf("ring_set_autogrow(): ERROR: Bad max length or shrink %%.\n");
+        exit(EXIT_FAILURE);
+    }
+    if (ring->Flags & (RING_F_STATIC | RING_F_MIRRORED | RING_F_ARENA))
+    {
+        printf("ring_set_autogrow(): ERROR: Only heap rings can grow.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    ring->Grow_Max = max_length;
+    ring->Grow_Min = ring->Length;
+    ring->Shrink_Pct = shrink_pct;
+    ring->Flags |= RING_F_GROW;
+}
+
+size_t entries(ring_t *ring)
+{
+    // Verify.
+    if (!is_ring_valid(ring)) { exit(EXIT_FAILURE); }
+
+    // Load Outi first so a concurrent producer can only make the count
+    // larger, never negative.
+    size_t outi = atomic_load_explicit(&ring->Outi, memory_order_acquire);
+    size_t ini = atomic_load_explicit(&ring->Ini, memory_order_acquire);
+    return (ini - outi);
 }
 
 // For debugging.
@@ -131,9 +595,9 @@ void show(ring_t *ring)
     { exit(EXIT_FAILURE); }
 
     // Print content of buffer.
-    for (int i = 0; i < ring->Length; i++)
+    for (size_t i = 0; i < ring->Length; i++)
     {
-        printf("At [%d], value is: %c\n", i, ring->Buffer[i]);
+        printf("At [%zu], value is: %c\n", i, ring->Buffer[i]);
     }
 }
 
@@ -143,6 +607,27 @@ void clean(ring_t *ring)
     if (!is_ring_valid(ring) || !is_ring_buffer_valid(ring))
     { exit(EXIT_FAILURE); }
 
+    // Stats are on the heap whatever the ring's storage.
+    ring_stats_disable(ring);
+
+    // Static and arena rings own no heap memory; just empty them.
+    if (ring->Flags & (RING_F_STATIC | RING_F_ARENA))
+    {
+        atomic_store(&ring->Ini, 0);
+        atomic_store(&ring->Outi, 0);
+        atomic_store(&ring->Overwritten, 0);
+        ring->Outi_Cache = 0;
+        ring->Ini_Cache = 0;
+        return;
+    }
+
+    // Mirrored rings are mapped, not allocated.
+    if (ring->Flags & RING_F_MIRRORED)
+    {
+        printf("clean(): ERROR: Use clean_mirrored() for mirrored rings.\n");
+        exit(EXIT_FAILURE);
+    }
+
     // Free memory.
     free(ring->Buffer);
     ring->Buffer = NULL;
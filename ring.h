@@ -15,23 +15,220 @@
 #ifndef RING_H
 #define RING_H
 
-typedef struct
+#include <stdatomic.h>
+#include <stddef.h>
+
+// Size of a cache line. The producer and consumer indices are kept at least
+// this far apart so the two sides of a ring never write to the same line.
+#ifndef RING_CACHE_LINE
+#define RING_CACHE_LINE 64
+#endif
+
+// The ring is safe for one producer and one consumer running concurrently
+// (e.g. UART0_IRQHandler and the main loop, or two threads). Ini is only
+// written by the producer and Outi only by the consumer; each is published
+// with release and read with acquire. Each side keeps a cached copy of the
+// other side's index and only reloads it when the ring looks full/empty.
+//
+// Ini and Outi are unsigned and only ever increase, wrapping modulo
+// SIZE_MAX + 1. Since Length is a power of 2 it divides that modulus, so
+// Ini - Outi and the masked slot stay correct across the wrap.
+typedef struct ring_s
 {
+    // Shared, fixed after init().
     char *Buffer;
-    int Length;
-    int Ini;
-    int Outi;
-    int Adj_Len;
+    size_t Length;
+    size_t Adj_Len;
+    int Flags; // RING_F_* bits
+
+    // Optional hooks, NULL when unused. On_Insert runs after the producer
+    // publishes Ini and On_Remove after the consumer publishes Outi;
+    // Notify_Ctx is their state. Used by ring_wait.h.
+    void (*On_Insert)(struct ring_s *ring);
+    void (*On_Remove)(struct ring_s *ring);
+    void *Notify_Ctx;
+
+    // Optional counters, NULL when off. See ring_stats.h.
+    struct ring_stats_s *Stats;
+
+    // Auto-grow policy, only used with RING_F_GROW. See ring_set_autogrow().
+    size_t Grow_Max; // never grow past this length
+    size_t Grow_Min; // never shrink below this length
+    unsigned Shrink_Pct; // halve when at most this % full, 0 = never
+
+    // Producer side.
+    _Alignas(RING_CACHE_LINE) atomic_size_t Ini;
+    size_t Outi_Cache; // producer's last view of Outi
+    atomic_size_t Overwritten; // entries dropped by RING_F_OVERWRITE
+
+    // Consumer side.
+    _Alignas(RING_CACHE_LINE) atomic_size_t Outi;
+    size_t Ini_Cache; // consumer's last view of Ini
 } ring_t;
 
+// Ring flags.
+#define RING_F_STATIC 0x01 // storage from RING_DEFINE(), not the heap
+#define RING_F_MIRRORED 0x02 // buffer mapped twice, see ring_mirror.h
+#define RING_F_OVERWRITE 0x04 // full ring drops its oldest entry on insert
+#define RING_F_ARENA 0x08 // storage from a ring arena, see ring_arena.h
+#define RING_F_GROW 0x10 // resized on demand, see ring_set_autogrow()
+
+// Overwrite mode (ring_set_overwrite()): when the ring is full, inserts advance
+// Outi past the oldest entries instead of failing, and count them in
+// Overwritten. Since both sides then move Outi, the consumer advances it with
+// a CAS and retries if the producer got there first. The consumer may then
+// read a slot while the producer rewrites it, so both sides copy bytes in this
+// mode with relaxed atomic accesses (ring_store_bytes()/ring_load_bytes()) and
+// a torn read is thrown away when the CAS fails. ring_reserve(), ring_peek()
+// and ring_consume() are not safe on such rings while the producer is running.
+
+// Resizing (ring_resize(), ring_set_autogrow()) swaps Buffer and Length under
+// both sides, so it is only for heap rings owned by one thread: no other
+// thread may touch the ring while it runs. An auto-grow ring resizes itself
+// inside insert(), insert_n(), my_remove() and remove_n(); the lock-free
+// ring_insert()/ring_remove() and span calls never resize.
+
+// Declare a ring of N chars with its storage in .bss, at file scope. N must be
+// a power of 2; this is checked at compile time. Defines:
+//   name_ring          the ring_t, usable with all the ring functions
+//   name_insert(data)  same as ring_insert() on it, with N folded in
+//   name_remove(&data) same as ring_remove() on it, with N folded in
+// No heap or runtime setup is needed.
+#define RING_DEFINE(name, N)                                                   \
+    _Static_assert((N) > 0 && ((N) & ((N) - 1)) == 0,                          \
+                   "RING_DEFINE(" #name "): length must be a power of 2");     \
+    static char name##_buffer[N];                                              \
+    static ring_t name##_ring = { .Buffer = name##_buffer, .Length = (N),      \
+                                  .Adj_Len = (N) - 1, .Flags = RING_F_STATIC };\
+    static inline int name##_insert(char data)                                 \
+    { return ring_insert_fixed(&name##_ring, data, (N)); }                     \
+    static inline int name##_remove(char *data)                                \
+    { return ring_remove_fixed(&name##_ring, data, (N)); }
 
 int is_ring_valid(ring_t *ring);
 int is_ring_buffer_valid(ring_t *ring);
-ring_t* init(int length);
+ring_t* init(size_t length);
+void ring_init_fields(ring_t *ring, char *buffer, size_t length, int flags);
 int insert(ring_t *ring, char data);
 int my_remove(ring_t *ring, char *data);
-int entries(ring_t *ring);
+int ring_insert(ring_t *ring, char data);
+int ring_remove(ring_t *ring, char *data);
+size_t insert_n(ring_t *ring, const char *src, size_t n);
+size_t remove_n(ring_t *ring, char *dst, size_t n);
+size_t ring_reserve(ring_t *ring, size_t max, char **ptr);
+void ring_commit(ring_t *ring, size_t n);
+size_t ring_peek(ring_t *ring, char **ptr);
+void ring_consume(ring_t *ring, size_t n);
+size_t entries(ring_t *ring);
 void show(ring_t *ring);
 void clean(ring_t *ring);
+void ring_set_overwrite(ring_t *ring, int enable);
+size_t ring_overwritten(ring_t *ring);
+void ring_overwrite_oldest(ring_t *ring, size_t ini, size_t n);
+int ring_remove_cas(ring_t *ring, char *data);
+int ring_resize(ring_t *ring, size_t length);
+void ring_set_autogrow(ring_t *ring, size_t max_length, unsigned shrink_pct);
+void ring_stats_insert(ring_t *ring, size_t n);
+void ring_stats_remove(ring_t *ring, size_t n);
+
+// Copy n bytes into ring storage with relaxed atomic byte stores. For slots a
+// reader may be copying at the same time; see overwrite mode above.
+static inline void ring_store_bytes(char *dst, const char *src, size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+    {
+        atomic_store_explicit((_Atomic char *)(dst + i), src[i],
+                              memory_order_relaxed);
+    }
+}
+
+// Copy n bytes out of ring storage with relaxed atomic byte loads. The bytes
+// may be torn; the caller must check they were not overwritten before use.
+static inline void ring_load_bytes(char *dst, const char *src, size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+    {
+        dst[i] = atomic_load_explicit((_Atomic char *)(src + i),
+                                      memory_order_relaxed);
+    }
+}
+
+// Run the producer's hooks, if any, after it publishes n entries; n is 0 when
+// an insert failed because the ring was full.
+static inline void ring_notify_insert(ring_t *ring, size_t n)
+{
+    if (ring->Stats) { ring_stats_insert(ring, n); }
+    if (n && ring->On_Insert) { ring->On_Insert(ring); }
+}
+
+// Run the consumer's hooks, if any, after it publishes n entries; n is 0 when
+// a remove failed because the ring was empty.
+static inline void ring_notify_remove(ring_t *ring, size_t n)
+{
+    if (ring->Stats) { ring_stats_remove(ring, n); }
+    if (n && ring->On_Remove) { ring->On_Remove(ring); }
+}
+
+// Lock-free single-producer insert with the ring length passed in, so a
+// constant length becomes an immediate mask. Used by ring_insert() and
+// RING_DEFINE().
+static inline int ring_insert_fixed(ring_t *ring, char data, size_t length)
+{
+    size_t ini = atomic_load_explicit(&ring->Ini, memory_order_relaxed);
+
+    // Only reload Outi when the cached copy says the ring is full.
+    if ((ini - ring->Outi_Cache) == length)
+    {
+        ring->Outi_Cache = atomic_load_explicit(&ring->Outi,
+                                                memory_order_acquire);
+        if ((ini - ring->Outi_Cache) == length)
+        {
+            if (!(ring->Flags & RING_F_OVERWRITE))
+            {
+                ring_notify_insert(ring, 0);
+                return 0;
+            }
+            ring_overwrite_oldest(ring, ini, 1);
+        }
+    }
+
+    // Write the slot, then publish it to the consumer. The store is atomic
+    // for overwrite mode, where the consumer may be reading the same slot; a
+    // relaxed char store is a plain store on every target.
+    atomic_store_explicit((_Atomic char *)&ring->Buffer[ini & (length - 1)],
+                          data, memory_order_relaxed);
+    atomic_store_explicit(&ring->Ini, ini + 1, memory_order_release);
+    ring_notify_insert(ring, 1);
+    return 1;
+}
+
+// Lock-free single-consumer remove with the ring length passed in. Used by
+// ring_remove() and RING_DEFINE().
+static inline int ring_remove_fixed(ring_t *ring, char *data,
+                                    size_t length)
+{
+    // The producer may also move Outi in overwrite mode.
+    if (ring->Flags & RING_F_OVERWRITE) { return ring_remove_cas(ring, data); }
+
+    size_t outi = atomic_load_explicit(&ring->Outi, memory_order_relaxed);
+
+    // Only reload Ini when the cached copy says the ring is empty.
+    if (outi == ring->Ini_Cache)
+    {
+        ring->Ini_Cache = atomic_load_explicit(&ring->Ini,
+                                               memory_order_acquire);
+        if (outi == ring->Ini_Cache)
+        {
+            ring_notify_remove(ring, 0);
+            return 0;
+        }
+    }
+
+    // Read the slot, then hand it back to the producer.
+    *data = ring->Buffer[outi & (length - 1)];
+    atomic_store_explicit(&ring->Outi, outi + 1, memory_order_release);
+    ring_notify_remove(ring, 1);
+    return 1;
+}
 
 #endif
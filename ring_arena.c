@@ -0,0 +1,87 @@
+/*******************************************************************************
+ *
+ * Copyright (C) 2026 by the ring buffer contributors
+ *
+ ******************************************************************************/
+
+/*
+ * @file ring_arena.c
+ * @brief Library definitions for allocating many rings from one slab.
+ *
+ * @date October 16, 2026
+ */
+
+#include "ring_arena.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+// Round n up to a whole number of cache lines.
+static size_t line_round(size_t n)
+{
+    return (n + RING_CACHE_LINE - 1) & ~(size_t)(RING_CACHE_LINE - 1);
+}
+
+// Create an arena holding up to max_rings rings with buffer_bytes of buffer
+// space between them. Each ring's buffer uses its length rounded up to
+// RING_CACHE_LINE. Returns NULL if the slab cannot be allocated.
+ring_arena_t* ring_arena_create(size_t max_rings, size_t buffer_bytes)
+{
+    size_t head = line_round(sizeof(ring_arena_t));
+    if (max_rings > (SIZE_MAX - head) / sizeof(ring_t))
+    {
+        printf("ring_arena_create(): ERROR: Too many rings.\n");
+        return NULL;
+    }
+    size_t rings = max_rings * sizeof(ring_t);
+    size_t bufs = line_round(buffer_bytes);
+    if (bufs < buffer_bytes || bufs > SIZE_MAX - head - rings)
+    {
+        printf("ring_arena_create(): ERROR: Arena too large.\n");
+        return NULL;
+    }
+
+    // One allocation for the arena, the headers and the buffers.
+    char *slab = aligned_alloc(RING_CACHE_LINE, head + rings + bufs);
+    if (slab == NULL) { return NULL; }
+
+    ring_arena_t *arena = (ring_arena_t *)slab;
+    arena->Rings = (ring_t *)(slab + head);
+    arena->Max_Rings = max_rings;
+    arena->Num_Rings = 0;
+    arena->Next = slab + head + rings;
+    arena->End = arena->Next + bufs;
+    return arena;
+}
+
+// Carve a ring of length chars (a power of 2) out of arena. Returns NULL when
+// the arena is out of headers or buffer space.
+ring_t* ring_arena_alloc(ring_arena_t *arena, size_t length)
+{
+    // Confirm length is a power of 2.
+    if (!((length != 0) && !(length & (length - 1))))
+    {
+        printf("ring_arena_alloc(): ERROR: Length of ring must be a power "
+               "of 2.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    size_t span = line_round(length);
+    if (arena->Num_Rings == arena->Max_Rings || span < length ||
+        span > (size_t)(arena->End - arena->Next))
+    {
+        return NULL;
+    }
+
+    ring_t *ring = &arena->Rings[arena->Num_Rings++];
+    ring_init_fields(ring, arena->Next, length, RING_F_ARENA);
+    arena->Next += span;
+
+    return ring;
+}
+
+// Free arena and every ring allocated from it.
+void ring_arena_free(ring_arena_t *arena)
+{
+    free(arena);
+}
@@ -0,0 +1,41 @@
+/*******************************************************************************
+ *
+ * Copyright (C) 2026 by the ring buffer contributors
+ *
+ ******************************************************************************/
+
+/*
+ * @file ring_arena.h
+ * @brief Library declarations for allocating many rings from one slab.
+ *
+ * @date October 16, 2026
+ *
+ * ring_arena_create() makes one cache-line-aligned allocation laid out as:
+ *   [ring_arena_t][ring_t x max_rings][buffers ...]
+ * The ring_t headers are a dense array (arena->Rings), so scanning every ring
+ * walks memory in order. ring_arena_alloc() hands out the next header and
+ * bump-allocates its buffer, rounded up to a cache line so no two rings share
+ * a buffer line. It does no malloc and no locking, so call it from one thread.
+ * Arena rings work with all the ring.h functions. clean() just empties them;
+ * ring_arena_free() releases every ring at once.
+ */
+
+#ifndef RING_ARENA_H
+#define RING_ARENA_H
+
+#include "ring.h"
+
+typedef struct
+{
+    ring_t *Rings; // dense header array, Num_Rings in use
+    size_t Max_Rings;
+    size_t Num_Rings;
+    char *Next; // next free buffer byte
+    char *End; // end of the slab
+} ring_arena_t;
+
+ring_arena_t* ring_arena_create(size_t max_rings, size_t buffer_bytes);
+ring_t* ring_arena_alloc(ring_arena_t *arena, size_t length);
+void ring_arena_free(ring_arena_t *arena);
+
+#endif
@@ -0,0 +1,229 @@
+/*******************************************************************************
+ *
+ * Copyright (C) 2026 by the ring buffer contributors
+ *
+ ******************************************************************************/
+
+/*
+ * @file ring_bcast.c
+ * @brief Library definitions for a single-producer/multi-consumer broadcast
+ *        ring.
+ *
+ * @date October 16, 2026
+ *
+ * NOTES:
+ * In drop mode the producer may overwrite bytes that a dropped reader is
+ * copying at that moment. The producer marks the reader dropped with an
+ * acq_rel CAS and only writes after it. The reader copies, then checks its
+ * state with an acq_rel read-modify-write (fetch_or 0). Both operations are on
+ * State, so one of them comes first. If the reader's check comes first, the
+ * CAS acquires its release and the copy happened before any overwrite.
+ * Otherwise the check sees BCAST_DROPPED and the copy is thrown away. Since
+ * the copy and the overwrite may still overlap, both sides copy with relaxed
+ * atomic byte accesses in drop mode (ring_store_bytes()/ring_load_bytes()).
+ * Outside drop mode the reader skips the check and both sides use memcpy.
+ */
+
+#include "ring_bcast.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+bcast_ring_t* bcast_init(size_t length, int drop_laggards)
+{
+    // Confirm length is a power of 2.
+    if (!((length != 0) && !(length & (length - 1))))
+    {
+        printf("bcast_init(): ERROR: Length of ring must be a power of 2.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    // Alloc and verify ring. Aligned so each cursor gets its own cache line.
+    bcast_ring_t *ring = aligned_alloc(RING_CACHE_LINE, sizeof(bcast_ring_t));
+    if (ring == NULL)
+    {
+        printf("bcast_init(): ERROR: Ring is NULL.\n");
+        exit(EXIT_FAILURE);
+    }
+    ring->Buffer = malloc(length * sizeof(char));
+    if (ring->Buffer == NULL)
+    {
+        printf("bcast_init(): ERROR: Ring buffer is NULL.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    // Set ring parameters. No readers yet.
+    ring->Length = length;
+    ring->Adj_Len = length - 1;
+    ring->Drop_Laggards = drop_laggards;
+    atomic_init(&ring->Ini, 0);
+    ring->Min_Cache = 0;
+    for (int i = 0; i < BCAST_MAX_READERS; i++)
+    {
+        atomic_init(&ring->Readers[i].Outi, 0);
+        atomic_init(&ring->Readers[i].State, BCAST_FREE);
+        ring->Readers[i].Ini_Cache = 0;
+    }
+
+    // Return ring.
+    return ring;
+}
+
+// Add a reader that sees every byte inserted from now on. Call from the
+// producer's thread, or before it starts, so no insert can pass the reader
+// before it is counted. Returns the reader id, or -1 if all slots are taken.
+int bcast_subscribe(bcast_ring_t *ring)
+{
+    size_t ini = atomic_load_explicit(&ring->Ini, memory_order_relaxed);
+    for (int i = 0; i < BCAST_MAX_READERS; i++)
+    {
+        bcast_reader_t *r = &ring->Readers[i];
+        int state = atomic_load_explicit(&r->State, memory_order_acquire);
+        if (state != BCAST_FREE) { continue; }
+
+        atomic_store_explicit(&r->Outi, ini, memory_order_relaxed);
+        r->Ini_Cache = ini;
+        atomic_store_explicit(&r->State, BCAST_ACTIVE, memory_order_release);
+        return i;
+    }
+    return -1;
+}
+
+// Remove a reader, freeing its slot; a dropped reader must do this before it
+// subscribes again. Any thread may call this.
+void bcast_unsubscribe(bcast_ring_t *ring, int reader)
+{
+    atomic_store_explicit(&ring->Readers[reader].State, BCAST_FREE,
+                          memory_order_release);
+}
+
+int bcast_is_dropped(bcast_ring_t *ring, int reader)
+{
+    return atomic_load_explicit(&ring->Readers[reader].State,
+                                memory_order_acquire) == BCAST_DROPPED;
+}
+
+// Outi of the slowest active reader, or ini if there are none. In drop mode,
+// readers so far behind that fewer than n bytes would be free are dropped.
+static size_t slowest(bcast_ring_t *ring, size_t ini, size_t n)
+{
+    size_t min = ini;
+    for (int i = 0; i < BCAST_MAX_READERS; i++)
+    {
+        bcast_reader_t *r = &ring->Readers[i];
+        if (atomic_load_explicit(&r->State, memory_order_acquire) !=
+            BCAST_ACTIVE)
+        {
+            continue;
+        }
+
+        size_t outi = atomic_load_explicit(&r->Outi, memory_order_acquire);
+        if (ring->Drop_Laggards && ring->Length - (ini - outi) < n)
+        {
+            int active = BCAST_ACTIVE;
+            if (atomic_compare_exchange_strong_explicit(&r->State, &active,
+                    BCAST_DROPPED, memory_order_acq_rel, memory_order_acquire))
+            {
+                continue;
+            }
+        }
+        if (ini - outi > ini - min) { min = outi; }
+    }
+    return min;
+}
+
+// Insert up to n bytes from src with at most two copies and a single publish
+// of Ini. Returns the number of bytes inserted, which is less than n if the
+// slowest reader is a whole ring behind.
+size_t bcast_insert_n(bcast_ring_t *ring, const char *src, size_t n)
+{
+    size_t ini = atomic_load_explicit(&ring->Ini, memory_order_relaxed);
+
+    // Only rescan the readers when the cached minimum does not leave room.
+    size_t space = ring->Length - (ini - ring->Min_Cache);
+    if (space < n)
+    {
+        if (n > ring->Length) { n = ring->Length; }
+        ring->Min_Cache = slowest(ring, ini, n);
+        space = ring->Length - (ini - ring->Min_Cache);
+    }
+    if (n > space) { n = space; }
+    if (n == 0) { return 0; }
+
+    // Copy up to the end of the buffer, then the rest from the start.
+    size_t start = ini & ring->Adj_Len;
+    size_t first = ring->Length - start;
+    if (first > n) { first = n; }
+    if (ring->Drop_Laggards)
+    {
+        ring_store_bytes(ring->Buffer + start, src, first);
+        ring_store_bytes(ring->Buffer, src + first, n - first);
+    }
+    else
+    {
+        memcpy(ring->Buffer + start, src, first);
+        memcpy(ring->Buffer, src + first, n - first);
+    }
+
+    atomic_store_explicit(&ring->Ini, ini + n, memory_order_release);
+    return n;
+}
+
+// Reader: remove up to n bytes into dst. Returns the number of bytes removed;
+// 0 if there are none, or if the reader has been dropped.
+size_t bcast_remove_n(bcast_ring_t *ring, int reader, char *dst, size_t n)
+{
+    bcast_reader_t *r = &ring->Readers[reader];
+    size_t outi = atomic_load_explicit(&r->Outi, memory_order_relaxed);
+
+    // Only reload Ini when the cached copy does not hold enough bytes.
+    size_t avail = r->Ini_Cache - outi;
+    if (avail < n)
+    {
+        r->Ini_Cache = atomic_load_explicit(&ring->Ini, memory_order_acquire);
+        avail = r->Ini_Cache - outi;
+    }
+    if (n > avail) { n = avail; }
+    if (n == 0) { return 0; }
+
+    // Copy up to the end of the buffer, then the rest from the start.
+    size_t start = outi & ring->Adj_Len;
+    size_t first = ring->Length - start;
+    if (first > n) { first = n; }
+
+    // In drop mode the copy is only good if the reader was not dropped.
+    if (ring->Drop_Laggards)
+    {
+        ring_load_bytes(dst, ring->Buffer + start, first);
+        ring_load_bytes(dst + first, ring->Buffer, n - first);
+        if (atomic_fetch_or_explicit(&r->State, 0, memory_order_acq_rel) !=
+            BCAST_ACTIVE)
+        {
+            return 0;
+        }
+    }
+    else
+    {
+        memcpy(dst, ring->Buffer + start, first);
+        memcpy(dst + first, ring->Buffer, n - first);
+    }
+
+    atomic_store_explicit(&r->Outi, outi + n, memory_order_release);
+    return n;
+}
+
+// Bytes waiting for reader.
+size_t bcast_entries(bcast_ring_t *ring, int reader)
+{
+    size_t outi = atomic_load_explicit(&ring->Readers[reader].Outi,
+                                       memory_order_acquire);
+    size_t ini = atomic_load_explicit(&ring->Ini, memory_order_acquire);
+    return (ini - outi);
+}
+
+void bcast_clean(bcast_ring_t *ring)
+{
+    free(ring->Buffer);
+    ring->Buffer = NULL;
+    free(ring);
+}
@@ -0,0 +1,66 @@
+/*******************************************************************************
+ *
+ * Copyright (C) 2026 by the ring buffer contributors
+ *
+ ******************************************************************************/
+
+/*
+ * @file ring_bcast.h
+ * @brief Library declarations for a single-producer/multi-consumer broadcast
+ *        ring.
+ *
+ * @date October 16, 2026
+ */
+
+#ifndef RING_BCAST_H
+#define RING_BCAST_H
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include "ring.h"
+
+#define BCAST_MAX_READERS 8
+
+// Reader states.
+#define BCAST_FREE 0
+#define BCAST_ACTIVE 1
+#define BCAST_DROPPED 2 // fell a whole ring behind in drop mode
+
+// Every byte the producer inserts is delivered to every active reader. Each
+// reader has its own Outi on its own cache line, written only by that reader.
+// The producer only overwrites a byte once every active reader has consumed
+// it: its free space is Length minus the lag of the slowest reader. In drop
+// mode the producer instead marks readers that would block it BCAST_DROPPED
+// and moves on. A dropped reader gets no more data until it subscribes again.
+typedef struct
+{
+    _Alignas(RING_CACHE_LINE) atomic_size_t Outi;
+    atomic_int State; // BCAST_*
+    size_t Ini_Cache; // reader's last view of Ini
+} bcast_reader_t;
+
+typedef struct
+{
+    // Shared, fixed after bcast_init().
+    char *Buffer;
+    size_t Length;
+    size_t Adj_Len;
+    int Drop_Laggards;
+
+    // Producer side.
+    _Alignas(RING_CACHE_LINE) atomic_size_t Ini;
+    size_t Min_Cache; // producer's last view of the slowest reader's Outi
+
+    bcast_reader_t Readers[BCAST_MAX_READERS];
+} bcast_ring_t;
+
+bcast_ring_t* bcast_init(size_t length, int drop_laggards);
+int bcast_subscribe(bcast_ring_t *ring);
+void bcast_unsubscribe(bcast_ring_t *ring, int reader);
+int bcast_is_dropped(bcast_ring_t *ring, int reader);
+size_t bcast_insert_n(bcast_ring_t *ring, const char *src, size_t n);
+size_t bcast_remove_n(bcast_ring_t *ring, int reader, char *dst, size_t n);
+size_t bcast_entries(bcast_ring_t *ring, int reader);
+void bcast_clean(bcast_ring_t *ring);
+
+#endif
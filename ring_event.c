@@ -0,0 +1,144 @@
+/*******************************************************************************
+ *
+ * Copyright (C) 2026 by the ring buffer contributors
+ *
+ ******************************************************************************/
+
+/*
+ * @file ring_event.c
+ * @brief Library definitions for eventfd notification of ring state (Linux
+ *        only).
+ *
+ * @date October 16, 2026
+ *
+ * NOTES:
+ * Arming uses the same Dekker-style handshake as ring_wait.c. The side that
+ * ran dry sets Armed and then rechecks the ring. The other side publishes its
+ * index and then checks Armed. A seq_cst fence on each side means either the
+ * recheck sees the new state or the notifier sees Armed. Only the notifier
+ * that swaps Armed from 1 to 0 writes the eventfd, which coalesces the
+ * signals.
+ */
+
+#include "ring_event.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+
+// Signal fd if the other side armed it.
+static void signal_if_armed(int fd, atomic_int *armed)
+{
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(armed, memory_order_relaxed) &&
+        atomic_exchange_explicit(armed, 0, memory_order_relaxed))
+    {
+        uint64_t one = 1;
+        (void)!write(fd, &one, sizeof(one));
+    }
+}
+
+// On_Insert hook: the ring may have gone from empty to non-empty.
+static void on_insert(ring_t *ring)
+{
+    ring_event_t *ev = ring->Notify_Ctx;
+    signal_if_armed(ev->Readable_Fd, &ev->Readable_Armed);
+}
+
+// On_Remove hook: the ring may have gone from full to non-full.
+static void on_remove(ring_t *ring)
+{
+    ring_event_t *ev = ring->Notify_Ctx;
+    signal_if_armed(ev->Writable_Fd, &ev->Writable_Armed);
+}
+
+// Clear fd and arm it; the caller rechecks the ring afterwards.
+static void rearm(int fd, atomic_int *armed)
+{
+    uint64_t count;
+    (void)!read(fd, &count, sizeof(count)); // non-blocking; clears the fd
+
+    atomic_store_explicit(armed, 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+}
+
+// Attach a pair of eventfds to ring. The readable fd starts armed and the
+// writable fd disarmed, matching an empty ring: the producer arms it with
+// ring_event_rearm_writable() once it finds the ring full. Call before the
+// ring is shared. Returns 1 on success.
+int ring_event_attach(ring_t *ring)
+{
+    // Verify.
+    if (!is_ring_valid(ring)) { exit(EXIT_FAILURE); }
+    if (ring->On_Insert != NULL || ring->On_Remove != NULL)
+    {
+        printf("ring_event_attach(): ERROR: Ring already has hooks.\n");
+        return 0;
+    }
+
+    ring_event_t *ev = aligned_alloc(RING_CACHE_LINE, sizeof(ring_event_t));
+    if (ev == NULL) { return 0; }
+    ev->Readable_Fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    ev->Writable_Fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (ev->Readable_Fd < 0 || ev->Writable_Fd < 0)
+    {
+        if (ev->Readable_Fd >= 0) { close(ev->Readable_Fd); }
+        if (ev->Writable_Fd >= 0) { close(ev->Writable_Fd); }
+        free(ev);
+        return 0;
+    }
+    atomic_init(&ev->Readable_Armed, 1);
+    atomic_init(&ev->Writable_Armed, 0);
+
+    ring->Notify_Ctx = ev;
+    ring->On_Insert = on_insert;
+    ring->On_Remove = on_remove;
+    return 1;
+}
+
+// Remove the hooks and close the eventfds.
+void ring_event_detach(ring_t *ring)
+{
+    // Verify.
+    if (!is_ring_valid(ring)) { exit(EXIT_FAILURE); }
+
+    ring_event_t *ev = ring->Notify_Ctx;
+    ring->On_Insert = NULL;
+    ring->On_Remove = NULL;
+    ring->Notify_Ctx = NULL;
+    if (ev != NULL)
+    {
+        close(ev->Readable_Fd);
+        close(ev->Writable_Fd);
+        free(ev);
+    }
+}
+
+int ring_event_readable_fd(ring_t *ring)
+{
+    return ((ring_event_t *)ring->Notify_Ctx)->Readable_Fd;
+}
+
+int ring_event_writable_fd(ring_t *ring)
+{
+    return ((ring_event_t *)ring->Notify_Ctx)->Writable_Fd;
+}
+
+// Consumer: call after draining the ring. Returns 1 if more data arrived in
+// the meantime (keep draining), 0 if it is safe to wait on the readable fd.
+int ring_event_rearm_readable(ring_t *ring)
+{
+    ring_event_t *ev = ring->Notify_Ctx;
+    rearm(ev->Readable_Fd, &ev->Readable_Armed);
+    return entries(ring) > 0;
+}
+
+// Producer: call after filling the ring. Returns 1 if space was freed in the
+// meantime (keep writing), 0 if it is safe to wait on the writable fd.
+int ring_event_rearm_writable(ring_t *ring)
+{
+    ring_event_t *ev = ring->Notify_Ctx;
+    rearm(ev->Writable_Fd, &ev->Writable_Armed);
+    return entries(ring) < ring->Length;
+}
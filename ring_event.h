@@ -0,0 +1,51 @@
+/*******************************************************************************
+ *
+ * Copyright (C) 2026 by the ring buffer contributors
+ *
+ ******************************************************************************/
+
+/*
+ * @file ring_event.h
+ * @brief Library declarations for eventfd notification of ring state, so
+ *        rings can join an epoll loop (Linux only).
+ *
+ * @date October 16, 2026
+ *
+ * ring_event_attach() gives a ring two eventfds and installs its
+ * On_Insert/On_Remove hooks:
+ *   readable fd - signaled when the ring goes from empty to non-empty
+ *   writable fd - signaled when the ring goes from full to non-full
+ * Each fd is signaled at most once per arm. So a burst of inserts into an
+ * empty ring costs one write(2), not one per byte. A consumer in an epoll loop:
+ *   add ring_event_readable_fd(ring) to epoll (EPOLLIN), data.ptr = ring
+ *   on wakeup: do { drain with remove_n()/ring_peek() }
+ *              while (ring_event_rearm_readable(ring));
+ * Rearming clears the fd and rechecks the ring, so no transition is missed.
+ * Producers use the writable fd and ring_event_rearm_writable() the same way.
+ */
+
+#ifndef RING_EVENT_H
+#define RING_EVENT_H
+
+#include <stdatomic.h>
+#include "ring.h"
+
+typedef struct
+{
+    int Readable_Fd;
+    int Writable_Fd;
+
+    // Set by the consumer/producer when it runs out of data/space; the other
+    // side clears it and signals the fd.
+    _Alignas(RING_CACHE_LINE) atomic_int Readable_Armed;
+    _Alignas(RING_CACHE_LINE) atomic_int Writable_Armed;
+} ring_event_t;
+
+int ring_event_attach(ring_t *ring);
+void ring_event_detach(ring_t *ring);
+int ring_event_readable_fd(ring_t *ring);
+int ring_event_writable_fd(ring_t *ring);
+int ring_event_rearm_readable(ring_t *ring);
+int ring_event_rearm_writable(ring_t *ring);
+
+#endif
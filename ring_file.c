@@ -0,0 +1,125 @@
+/*******************************************************************************
+ *
+ * Copyright (C) 2026 by the ring buffer contributors
+ *
+ ******************************************************************************/
+
+/*
+ * @file ring_file.c
+ * @brief Library definitions for a file-backed ring that survives a restart.
+ *
+ * @date October 16, 2026
+ */
+
+#include "ring_file.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Open the ring stored at path, creating it with length chars (a power of 2)
+// if the file is new or empty. An existing ring resumes with its contents; it
+// must have the same length. A file with no magic, left by a crash between
+// sizing and formatting it, is formatted again. Returns NULL on failure.
+file_ring_t* file_ring_open(const char *path, size_t length,
+                            size_t sync_every)
+{
+    int fd = open(path, O_RDWR | O_CREAT, 0600);
+    if (fd < 0)
+    {
+        printf("file_ring_open(): ERROR: Cannot open %s.\n", path);
+        return NULL;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0)
+    {
+        printf("file_ring_open(): ERROR: Cannot stat %s.\n", path);
+        close(fd);
+        return NULL;
+    }
+
+    size_t size = PI_RING_SIZE(length);
+    int fresh = (st.st_size == 0);
+    if ((!fresh && (size_t)st.st_size != size) ||
+        (fresh && ftruncate(fd, size) != 0))
+    {
+        printf("file_ring_open(): ERROR: %s does not hold a ring of that "
+               "length.\n", path);
+        close(fd);
+        return NULL;
+    }
+
+    // The mapping keeps the file open.
+    void *mem = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mem == MAP_FAILED) { return NULL; }
+
+    // The magic is written last, so a zero magic means nothing was ever
+    // stored in the ring.
+    if (((pi_ring_t *)mem)->Magic == 0) { fresh = 1; }
+    pi_ring_t *ring = fresh ? pi_ring_format(mem, length)
+                            : pi_ring_check(mem, size);
+    file_ring_t *file = malloc(sizeof(file_ring_t));
+    if (ring == NULL || file == NULL)
+    {
+        free(file);
+        munmap(mem, size);
+        return NULL;
+    }
+
+    // The cached indices may be from before a crash; start from the real ones.
+    ring->Outi_Cache = atomic_load(&ring->Outi);
+    ring->Ini_Cache = atomic_load(&ring->Ini);
+
+    file->Ring = ring;
+    file->Size = size;
+    file->Sync_Every = sync_every;
+    file->Unsynced = 0;
+    return file;
+}
+
+// Count n moved bytes and msync once Sync_Every of them have built up.
+static void sync_cadence(file_ring_t *file, size_t n)
+{
+    file->Unsynced += n;
+    if (file->Sync_Every != 0 && file->Unsynced >= file->Sync_Every)
+    {
+        file_ring_sync(file);
+    }
+}
+
+// Insert up to n bytes from src, see pi_insert_n(). Returns the number of
+// bytes inserted.
+size_t file_ring_insert_n(file_ring_t *file, const char *src, size_t n)
+{
+    n = pi_insert_n(file->Ring, src, n);
+    sync_cadence(file, n);
+    return n;
+}
+
+// Remove up to n bytes into dst, see pi_remove_n(). Returns the number of
+// bytes removed.
+size_t file_ring_remove_n(file_ring_t *file, char *dst, size_t n)
+{
+    n = pi_remove_n(file->Ring, dst, n);
+    sync_cadence(file, n);
+    return n;
+}
+
+// Write the ring to disk now. Returns 1 on success.
+int file_ring_sync(file_ring_t *file)
+{
+    file->Unsynced = 0;
+    return msync(file->Ring, file->Size, MS_SYNC) == 0;
+}
+
+// Sync and unmap the ring. The file keeps its contents for the next open.
+void file_ring_close(file_ring_t *file)
+{
+    file_ring_sync(file);
+    munmap(file->Ring, file->Size);
+    free(file);
+}
@@ -0,0 +1,44 @@
+/*******************************************************************************
+ *
+ * Copyright (C) 2026 by the ring buffer contributors
+ *
+ ******************************************************************************/
+
+/*
+ * @file ring_file.h
+ * @brief Library declarations for a file-backed ring that survives a restart
+ *        (Linux/POSIX only).
+ *
+ * @date October 16, 2026
+ *
+ * The whole pi_ring_t (header with Ini/Outi, then the buffer) is mmapped
+ * MAP_SHARED from a file. Writes land in the page cache as they happen, so if
+ * the process dies, the next file_ring_open() finds every byte that was
+ * inserted and not yet removed and carries on from there. To survive an OS
+ * crash or power loss the pages must also reach the disk. Sync_Every sets how
+ * often: an msync after that many bytes have been inserted or removed
+ * (0 = only on file_ring_sync() and file_ring_close()). Smaller values lose
+ * less on power loss but cost throughput; see bench_persist.c.
+ */
+
+#ifndef RING_FILE_H
+#define RING_FILE_H
+
+#include "ring_pi.h"
+
+typedef struct
+{
+    pi_ring_t *Ring; // mapped from the file
+    size_t Size; // mapped bytes
+    size_t Sync_Every; // msync cadence in bytes, 0 = never
+    size_t Unsynced; // bytes moved since the last msync
+} file_ring_t;
+
+file_ring_t* file_ring_open(const char *path, size_t length,
+                            size_t sync_every);
+size_t file_ring_insert_n(file_ring_t *file, const char *src, size_t n);
+size_t file_ring_remove_n(file_ring_t *file, char *dst, size_t n);
+int file_ring_sync(file_ring_t *file);
+void file_ring_close(file_ring_t *file);
+
+#endif
@@ -0,0 +1,175 @@
+/*******************************************************************************
+ *
+ * Copyright (C) 2026 by the ring buffer contributors
+ *
+ ******************************************************************************/
+
+/*
+ * @file ring_find.c
+ * @brief Library definitions for searching the readable bytes of a ring.
+ *
+ * @date October 16, 2026
+ */
+
+#include "ring_find.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define VEC_LEN 32
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define VEC_LEN 16
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define VEC_LEN 16
+#endif
+
+// Index of the first byte of p[0..n) that is in set[0..nset), or n if none.
+// nset is 1..RING_FIND_SET_MAX.
+static size_t scan_vec(const char *p, size_t n, const char *set, size_t nset)
+{
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    __m256i needles[RING_FIND_SET_MAX];
+    for (size_t k = 0; k < nset; k++) { needles[k] = _mm256_set1_epi8(set[k]); }
+    for (; i + VEC_LEN <= n; i += VEC_LEN)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(p + i));
+        __m256i eq = _mm256_cmpeq_epi8(v, needles[0]);
+        for (size_t k = 1; k < nset; k++)
+        {
+            eq = _mm256_or_si256(eq, _mm256_cmpeq_epi8(v, needles[k]));
+        }
+        unsigned mask = (unsigned)_mm256_movemask_epi8(eq);
+        if (mask) { return i + __builtin_ctz(mask); }
+    }
+#elif defined(__SSE2__)
+    __m128i needles[RING_FIND_SET_MAX];
+    for (size_t k = 0; k < nset; k++) { needles[k] = _mm_set1_epi8(set[k]); }
+    for (; i + VEC_LEN <= n; i += VEC_LEN)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i *)(p + i));
+        __m128i eq = _mm_cmpeq_epi8(v, needles[0]);
+        for (size_t k = 1; k < nset; k++)
+        {
+            eq = _mm_or_si128(eq, _mm_cmpeq_epi8(v, needles[k]));
+        }
+        unsigned mask = (unsigned)_mm_movemask_epi8(eq);
+        if (mask) { return i + __builtin_ctz(mask); }
+    }
+#elif defined(__ARM_NEON)
+    uint8x16_t needles[RING_FIND_SET_MAX];
+    for (size_t k = 0; k < nset; k++) { needles[k] = vdupq_n_u8(set[k]); }
+    for (; i + VEC_LEN <= n; i += VEC_LEN)
+    {
+        uint8x16_t v = vld1q_u8((const uint8_t *)(p + i));
+        uint8x16_t eq = vceqq_u8(v, needles[0]);
+        for (size_t k = 1; k < nset; k++)
+        {
+            eq = vorrq_u8(eq, vceqq_u8(v, needles[k]));
+        }
+        // Narrow to 4 bits per byte, since NEON has no movemask.
+        uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(
+                            vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+        if (mask) { return i + (__builtin_ctzll(mask) >> 2); }
+    }
+#endif
+
+    // Tail, or everything without SIMD.
+    for (; i < n; i++)
+    {
+        for (size_t k = 0; k < nset; k++)
+        {
+            if (p[i] == set[k]) { return i; }
+        }
+    }
+    return n;
+}
+
+// scan_vec() for sets too big to compare one byte at a time.
+static size_t scan_table(const char *p, size_t n, const char *set,
+                         size_t nset)
+{
+    unsigned char in_set[256] = {0};
+    for (size_t k = 0; k < nset; k++) { in_set[(unsigned char)set[k]] = 1; }
+    for (size_t i = 0; i < n; i++)
+    {
+        if (in_set[(unsigned char)p[i]]) { return i; }
+    }
+    return n;
+}
+
+// Search the readable bytes at offsets [from, to) from Outi, in the spans
+// before and after the wrap point, for any of the nset bytes in set.
+static ptrdiff_t find(ring_t *ring, const char *set, size_t nset, size_t from,
+                      size_t to)
+{
+    // Verify.
+    if (!is_ring_valid(ring) || !is_ring_buffer_valid(ring))
+    { exit(EXIT_FAILURE); }
+
+    size_t outi = atomic_load_explicit(&ring->Outi, memory_order_relaxed);
+    ring->Ini_Cache = atomic_load_explicit(&ring->Ini, memory_order_acquire);
+    size_t avail = ring->Ini_Cache - outi;
+    if (to > avail) { to = avail; }
+    if (from >= to) { return -1; }
+    size_t len = to - from;
+
+    // A mirrored ring is contiguous across the wrap point.
+    size_t start = (outi + from) & ring->Adj_Len;
+    size_t first = (ring->Flags & RING_F_MIRRORED) ? len
+                                                   : ring->Length - start;
+    if (first > len) { first = len; }
+
+    const char *spans[2] = {ring->Buffer + start, ring->Buffer};
+    size_t lens[2] = {first, len - first};
+    size_t base = from;
+    for (int s = 0; s < 2; s++)
+    {
+        size_t i = (nset <= RING_FIND_SET_MAX)
+                   ? scan_vec(spans[s], lens[s], set, nset)
+                   : scan_table(spans[s], lens[s], set, nset);
+        if (i < lens[s]) { return base + i; }
+        base += lens[s];
+    }
+    return -1;
+}
+
+// Offset from Outi of the first readable byte equal to byte, or -1.
+ptrdiff_t ring_find(ring_t *ring, char byte)
+{
+    return find(ring, &byte, 1, 0, SIZE_MAX);
+}
+
+// Offset from Outi of the first readable byte that appears in the
+// NUL-terminated string set, or -1. set must not be empty.
+ptrdiff_t ring_find_any(ring_t *ring, const char *set)
+{
+    return ring_find_any_range(ring, set, 0, SIZE_MAX);
+}
+
+// ring_find(), only looking at the readable bytes at offsets [from, to) from
+// Outi. The offset returned is still counted from Outi.
+ptrdiff_t ring_find_range(ring_t *ring, char byte, size_t from, size_t to)
+{
+    return find(ring, &byte, 1, from, to);
+}
+
+// ring_find_any(), only looking at the readable bytes at offsets [from, to)
+// from Outi. The offset returned is still counted from Outi.
+ptrdiff_t ring_find_any_range(ring_t *ring, const char *set, size_t from,
+                              size_t to)
+{
+    size_t nset = strlen(set);
+    if (nset == 0)
+    {
+        printf("ring_find_any(): ERROR: Empty set.\n");
+        return -1;
+    }
+    return find(ring, set, nset, from, to);
+}
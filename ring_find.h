@@ -0,0 +1,41 @@
+/*******************************************************************************
+ *
+ * Copyright (C) 2026 by the ring buffer contributors
+ *
+ ******************************************************************************/
+
+/*
+ * @file ring_find.h
+ * @brief Library declarations for searching the readable bytes of a ring.
+ *
+ * @date October 16, 2026
+ *
+ * ring_find() and ring_find_any() scan the bytes from Outi to Ini without
+ * removing them. They search the span before the wrap point and then the
+ * span after it, and return the offset from Outi of the first match (so
+ * remove_n(ring, dst, offset + 1) takes everything up to and including it),
+ * or -1 if there is none. ring_find_range() and ring_find_any_range() only
+ * look at the bytes at offsets [from, to), so a caller can bound the scan or
+ * skip bytes it has already searched. The scan uses AVX2 when built with it
+ * (e.g. make CFLAGS+=-mavx2), otherwise SSE2 on x86-64 and NEON on ARM, and a
+ * byte loop on targets without SIMD such as the KL25Z. Only the consumer may
+ * call these, and not in overwrite mode.
+ */
+
+#ifndef RING_FIND_H
+#define RING_FIND_H
+
+#include <stddef.h>
+#include "ring.h"
+
+// Largest set ring_find_any() compares with vectors; bigger sets fall back
+// to a lookup table.
+#define RING_FIND_SET_MAX 8
+
+ptrdiff_t ring_find(ring_t *ring, char byte);
+ptrdiff_t ring_find_any(ring_t *ring, const char *set);
+ptrdiff_t ring_find_range(ring_t *ring, char byte, size_t from, size_t to);
+ptrdiff_t ring_find_any_range(ring_t *ring, const char *set, size_t from,
+                              size_t to);
+
+#endif
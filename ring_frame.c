@@ -0,0 +1,197 @@
+/*******************************************************************************
+ *
+ * Copyright (C) 2026 by the ring buffer contributors
+ *
+ ******************************************************************************/
+
+/*
+ * @file ring_frame.c
+ * @brief Library definitions for pulling lines or SLIP/COBS frames out of a
+ *        ring.
+ *
+ * @date October 16, 2026
+ */
+
+#include "ring_frame.h"
+#include "ring_find.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Set up fr to read frames of mode from ring, using scratch (max_len bytes)
+// for frames that wrap. No allocation, so fr and scratch may be static.
+void frame_init(frame_reader_t *fr, ring_t *ring, int mode, char *scratch,
+                size_t max_len)
+{
+    // Verify.
+    if (!is_ring_valid(ring) || !is_ring_buffer_valid(ring))
+    { exit(EXIT_FAILURE); }
+    if (mode < FRAME_LINE || mode > FRAME_COBS || scratch == NULL ||
+        max_len == 0)
+    {
+        printf("frame_init(): ERROR: Bad mode or scratch buffer.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    fr->Ring = ring;
+    fr->Mode = mode;
+    fr->Scratch = scratch;
+    fr->Max_Len = max_len;
+    fr->Pending = 0;
+    fr->Scanned = 0;
+    fr->Skipping = 0;
+    fr->Dropped = 0;
+}
+
+// Offset of the next delimiter from Outi, or -1. Only searches the bytes not
+// yet scanned, up to the longest frame plus its delimiter.
+static ptrdiff_t find_delim(frame_reader_t *fr)
+{
+    size_t from = fr->Scanned;
+    size_t to = fr->Max_Len + 1;
+    switch (fr->Mode)
+    {
+    case FRAME_SLIP: return ring_find_range(fr->Ring, (char)SLIP_END, from, to);
+    case FRAME_COBS: return ring_find_range(fr->Ring, 0, from, to);
+    default: return ring_find_any_range(fr->Ring, "\r\n", from, to);
+    }
+}
+
+// Drop n bytes from the ring.
+static void skip(frame_reader_t *fr, size_t n)
+{
+    char *ptr;
+    while (n > 0)
+    {
+        size_t span = ring_peek(fr->Ring, &ptr);
+        if (span > n) { span = n; }
+        ring_consume(fr->Ring, span);
+        n -= span;
+    }
+}
+
+// Decode SLIP escapes in place. Returns the decoded length, or -1 if an
+// escape is bad.
+static ptrdiff_t slip_decode(char *p, size_t n)
+{
+    size_t out = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        unsigned char c = p[i];
+        if (c == SLIP_ESC)
+        {
+            if (++i == n) { return -1; }
+            c = p[i];
+            if (c == SLIP_ESC_END) { c = SLIP_END; }
+            else if (c == SLIP_ESC_ESC) { c = SLIP_ESC; }
+            else { return -1; }
+        }
+        p[out++] = c;
+    }
+    return out;
+}
+
+// Decode COBS in place; the output never overtakes the input. Returns the
+// decoded length, or -1 if a code byte runs past the end.
+static ptrdiff_t cobs_decode(char *p, size_t n)
+{
+    size_t out = 0;
+    size_t i = 0;
+    while (i < n)
+    {
+        unsigned code = (unsigned char)p[i++];
+        if (code - 1 > n - i) { return -1; } // also rejects code 0
+        memmove(p + out, p + i, code - 1);
+        out += code - 1;
+        i += code - 1;
+        if (code < 0xFF && i < n) { p[out++] = 0; }
+    }
+    return out;
+}
+
+// Get the next complete frame. Returns 1 and points *frame at it (*len
+// bytes), or 0 if no complete frame is in the ring yet. Releases the previous
+// frame first.
+int frame_next(frame_reader_t *fr, char **frame, size_t *len)
+{
+    frame_release(fr);
+
+    for (;;)
+    {
+        ptrdiff_t d = find_delim(fr);
+        if (d < 0)
+        {
+            // Only the bytes up to the Ini the search loaded were searched;
+            // more may have arrived since.
+            size_t outi = atomic_load_explicit(&fr->Ring->Outi,
+                                               memory_order_relaxed);
+            size_t avail = fr->Ring->Ini_Cache - outi;
+            size_t scanned = (avail < fr->Max_Len + 1) ? avail
+                                                       : fr->Max_Len + 1;
+            if (!fr->Skipping && scanned <= fr->Max_Len)
+            {
+                // The frame is still arriving.
+                fr->Scanned = scanned;
+                return 0;
+            }
+
+            // No delimiter within Max_Len, so this frame is oversize: drop
+            // what was scanned and skip the rest of it as it arrives.
+            if (!fr->Skipping) { fr->Dropped++; }
+            fr->Skipping = 1;
+            fr->Scanned = 0;
+            skip(fr, scanned);
+            if (scanned == avail) { return 0; }
+            continue;
+        }
+        fr->Scanned = 0;
+
+        // The tail of a dropped frame, or an empty frame.
+        if (fr->Skipping || d == 0)
+        {
+            fr->Skipping = 0;
+            skip(fr, d + 1);
+            continue;
+        }
+
+        // View the frame in place, or copy it out if it wraps.
+        char *ptr;
+        size_t span = ring_peek(fr->Ring, &ptr);
+        if (span < (size_t)d)
+        {
+            memcpy(fr->Scratch, ptr, span);
+            ring_consume(fr->Ring, span);
+            ring_peek(fr->Ring, &ptr);
+            memcpy(fr->Scratch + span, ptr, d - span);
+            ring_consume(fr->Ring, d - span);
+            ptr = fr->Scratch;
+            fr->Pending = 1; // just the delimiter
+        }
+        else
+        {
+            fr->Pending = d + 1;
+        }
+
+        ptrdiff_t n = d;
+        if (fr->Mode == FRAME_SLIP) { n = slip_decode(ptr, d); }
+        else if (fr->Mode == FRAME_COBS) { n = cobs_decode(ptr, d); }
+        if (n < 0)
+        {
+            fr->Dropped++;
+            frame_release(fr);
+            continue;
+        }
+
+        *frame = ptr;
+        *len = n;
+        return 1;
+    }
+}
+
+// Consume the frame returned by frame_next() and its delimiter.
+void frame_release(frame_reader_t *fr)
+{
+    if (fr->Pending == 0) { return; }
+    skip(fr, fr->Pending);
+    fr->Pending = 0;
+}
@@ -0,0 +1,66 @@
+/*******************************************************************************
+ *
+ * Copyright (C) 2026 by the ring buffer contributors
+ *
+ ******************************************************************************/
+
+/*
+ * @file ring_frame.h
+ * @brief Library declarations for pulling lines or SLIP/COBS frames out of a
+ *        ring.
+ *
+ * @date October 16, 2026
+ *
+ * A frame reader sits on the consumer side of a ring, e.g. ring_rx:
+ *   FRAME_LINE  text lines ended by CR, LF or CR LF; empty lines are skipped
+ *   FRAME_SLIP  RFC 1055 frames ended by 0xC0, with escapes decoded
+ *   FRAME_COBS  COBS frames ended by 0x00, decoded
+ * frame_next() finds the next delimiter with ring_find_range() and returns a
+ * view of the frame. A frame that does not wrap is returned (and decoded) in
+ * place in the ring buffer. Only a frame that wraps is copied into the
+ * caller's scratch buffer. The view stays valid until frame_release() or the
+ * next frame_next(), which consume the frame.
+ *
+ * Max_Len limits the raw (encoded) frame length. A longer frame, or a SLIP or
+ * COBS frame that does not decode, is dropped and counted in Dropped. The
+ * reader then skips to the next delimiter, so it resyncs on the next frame
+ * without scanning more than Max_Len + 1 bytes at a time. While a frame is
+ * still arriving, the reader remembers how far it has searched, so each byte
+ * is scanned once rather than once per frame_next().
+ */
+
+#ifndef RING_FRAME_H
+#define RING_FRAME_H
+
+#include <stddef.h>
+#include "ring.h"
+
+// Frame modes.
+#define FRAME_LINE 0
+#define FRAME_SLIP 1
+#define FRAME_COBS 2
+
+// SLIP special bytes.
+#define SLIP_END 0xC0
+#define SLIP_ESC 0xDB
+#define SLIP_ESC_END 0xDC
+#define SLIP_ESC_ESC 0xDD
+
+typedef struct
+{
+    ring_t *Ring;
+    int Mode; // FRAME_*
+    char *Scratch; // Max_Len bytes, for frames that wrap
+    size_t Max_Len;
+    size_t Pending; // bytes the current view holds in the ring
+    size_t Scanned; // bytes from Outi already searched for a delimiter
+    int Skipping; // dropping bytes up to the next delimiter
+    size_t Dropped; // frames dropped as oversize or malformed
+} frame_reader_t;
+
+void frame_init(frame_reader_t *fr, ring_t *ring, int mode, char *scratch,
+                size_t max_len);
+int frame_next(frame_reader_t *fr, char **frame, size_t *len);
+void frame_release(frame_reader_t *fr);
+
+#endif
@@ -0,0 +1,101 @@
+/*******************************************************************************
+ *
+ * Copyright (C) 2026 by the ring buffer contributors
+ *
+ ******************************************************************************/
+
+/*
+ * @file ring_hist.c
+ * @brief Library definitions for counting byte values, e.g. into ascii[].
+ *
+ * @date October 16, 2026
+ */
+
+#include "ring_hist.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+// Bytes counted into the private tables before they are summed into hist, so
+// the 32-bit counts cannot overflow.
+#define HIST_CHUNK (1u << 30)
+
+static void hist_loop(int *hist, const unsigned char *p, size_t n)
+{
+    for (size_t i = 0; i < n; i++) { hist[p[i]]++; }
+}
+
+#if HIST_WAYS > 1
+// Count p[0..n) into HIST_WAYS tables, eight bytes per load, then add them
+// to hist.
+static void hist_ways(int *hist, const unsigned char *p, size_t n)
+{
+    uint32_t ways[HIST_WAYS][HIST_BINS];
+    memset(ways, 0, sizeof(ways));
+
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        uint64_t w;
+        memcpy(&w, p + i, sizeof(w));
+        ways[0][(uint8_t)w]++;
+        ways[1][(uint8_t)(w >> 8)]++;
+        ways[2][(uint8_t)(w >> 16)]++;
+        ways[3][(uint8_t)(w >> 24)]++;
+        ways[0][(uint8_t)(w >> 32)]++;
+        ways[1][(uint8_t)(w >> 40)]++;
+        ways[2][(uint8_t)(w >> 48)]++;
+        ways[3][(uint8_t)(w >> 56)]++;
+    }
+    for (; i < n; i++) { ways[0][p[i]]++; }
+
+    for (int b = 0; b < HIST_BINS; b++)
+    {
+        hist[b] += ways[0][b] + ways[1][b] + ways[2][b] + ways[3][b];
+    }
+}
+#endif
+
+// Add the count of each byte value in buf[0..n) to hist[HIST_BINS].
+void hist_bytes(int *hist, const char *buf, size_t n)
+{
+    const unsigned char *p = (const unsigned char *)buf;
+
+#if HIST_WAYS > 1
+    if (n >= HIST_BULK_MIN)
+    {
+        while (n > 0)
+        {
+            size_t chunk = n < HIST_CHUNK ? n : HIST_CHUNK;
+            hist_ways(hist, p, chunk);
+            p += chunk;
+            n -= chunk;
+        }
+        return;
+    }
+#endif
+
+    hist_loop(hist, p, n);
+}
+
+// Add the count of each byte value readable in ring to hist[HIST_BINS],
+// without removing them. Only the consumer may call this.
+void ring_hist(ring_t *ring, int *hist)
+{
+    // Verify.
+    if (!is_ring_valid(ring) || !is_ring_buffer_valid(ring))
+    { exit(EXIT_FAILURE); }
+
+    size_t outi = atomic_load_explicit(&ring->Outi, memory_order_relaxed);
+    ring->Ini_Cache = atomic_load_explicit(&ring->Ini, memory_order_acquire);
+    size_t avail = ring->Ini_Cache - outi;
+
+    // A mirrored ring is contiguous across the wrap point.
+    size_t start = outi & ring->Adj_Len;
+    size_t first = (ring->Flags & RING_F_MIRRORED) ? avail
+                                                   : ring->Length - start;
+    if (first > avail) { first = avail; }
+
+    hist_bytes(hist, ring->Buffer + start, first);
+    hist_bytes(hist, ring->Buffer, avail - first);
+}
@@ -0,0 +1,44 @@
+/*******************************************************************************
+ *
+ * Copyright (C) 2026 by the ring buffer contributors
+ *
+ ******************************************************************************/
+
+/*
+ * @file ring_hist.h
+ * @brief Library declarations for counting byte values, e.g. into ascii[].
+ *
+ * @date October 16, 2026
+ *
+ * hist_bytes() adds the count of each byte value in a buffer to hist[256].
+ * Bytes index hist as unsigned char, so values above 127 count in
+ * hist[128..255]. A byte loop on one table stalls when the same value
+ * repeats: each increment has to wait for the store before it. On the host,
+ * large buffers are counted instead into HIST_WAYS private tables, reading
+ * eight bytes per load, and the tables are summed at the end. The KL25Z has
+ * no room for the extra tables on its stack and no store forwarding to
+ * stall on, so it uses the byte loop. ring_hist() counts the readable bytes
+ * of a ring, both spans, without removing them.
+ */
+
+#ifndef RING_HIST_H
+#define RING_HIST_H
+
+#include <stddef.h>
+#include "ring.h"
+
+#define HIST_BINS 256
+
+#if defined(__ARM_ARCH_6M__) && !defined(__linux__)
+#define HIST_WAYS 1
+#else
+#define HIST_WAYS 4
+#endif
+
+// Buffers shorter than this use the byte loop; the tables cost more to sum.
+#define HIST_BULK_MIN 1024
+
+void hist_bytes(int *hist, const char *buf, size_t n);
+void ring_hist(ring_t *ring, int *hist);
+
+#endif
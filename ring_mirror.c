@@ -0,0 +1,102 @@
+/*******************************************************************************
+ *
+ * Copyright (C) 2026 by the ring buffer contributors
+ *
+ ******************************************************************************/
+
+/*
+ * @file ring_mirror.c
+ * @brief Library definitions for virtual-memory mirrored rings (Linux only).
+ *
+ * @date October 16, 2026
+ */
+
+#define _GNU_SOURCE // for memfd_create
+#include "ring_mirror.h"
+#include "ring_stats.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+// Map a memfd of length bytes twice in a row. Returns the start of the first
+// mapping, or NULL on failure.
+static char* map_mirrored(size_t length)
+{
+    int fd = memfd_create("ring_mirror", MFD_CLOEXEC);
+    if (fd < 0) { return NULL; }
+    if (ftruncate(fd, length) != 0)
+    {
+        close(fd);
+        return NULL;
+    }
+
+    // Reserve 2 * length of address space, then map the file over each half.
+    char *base = mmap(NULL, 2 * length, PROT_NONE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED)
+    {
+        close(fd);
+        return NULL;
+    }
+    if (mmap(base, length, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED,
+             fd, 0) == MAP_FAILED ||
+        mmap(base + length, length, PROT_READ | PROT_WRITE,
+             MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED)
+    {
+        munmap(base, 2 * length);
+        close(fd);
+        return NULL;
+    }
+
+    // The mappings keep the memory alive.
+    close(fd);
+    return base;
+}
+
+// Returns NULL if the mapping cannot be set up, so callers can fall back to
+// init().
+ring_t* init_mirrored(size_t length)
+{
+    // Confirm length is a power of 2 and a whole number of pages.
+    long page = sysconf(_SC_PAGESIZE);
+    if (!((length != 0) && !(length & (length - 1))) ||
+        (length % (size_t)page) != 0)
+    {
+        printf("init_mirrored(): ERROR: Length of ring must be a power of 2 "
+               "and a multiple of %ld.\n", page);
+        return NULL;
+    }
+
+    // Alloc and verify ring.
+    ring_t *ring = aligned_alloc(RING_CACHE_LINE, sizeof(ring_t));
+    if (!is_ring_valid(ring)) { return NULL; }
+
+    // Map and verify ring buffer.
+    char *buffer = map_mirrored(length);
+    if (buffer == NULL)
+    {
+        printf("init_mirrored(): ERROR: Cannot map mirrored buffer.\n");
+        free(ring);
+        return NULL;
+    }
+
+    // Set ring parameters.
+    ring_init_fields(ring, buffer, length, RING_F_MIRRORED);
+
+    // Return ring.
+    return ring;
+}
+
+void clean_mirrored(ring_t *ring)
+{
+    // Verify.
+    if (!is_ring_valid(ring) || !is_ring_buffer_valid(ring))
+    { exit(EXIT_FAILURE); }
+
+    // Unmap both halves and free the ring.
+    munmap(ring->Buffer, 2 * ring->Length);
+    ring->Buffer = NULL;
+    ring_stats_disable(ring);
+    free(ring);
+}
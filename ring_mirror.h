@@ -0,0 +1,29 @@
+/*******************************************************************************
+ *
+ * Copyright (C) 2026 by the ring buffer contributors
+ *
+ ******************************************************************************/
+
+/*
+ * @file ring_mirror.h
+ * @brief Library declarations for virtual-memory mirrored rings (Linux only).
+ *
+ * @date October 16, 2026
+ *
+ * A mirrored ring maps the same memfd pages twice, back to back, so
+ * Buffer[i] and Buffer[i + Length] are the same byte. Any span of up to Length
+ * bytes starting at any index is contiguous: ring_peek()/ring_reserve() never
+ * stop at the wrap point and bulk copies never split. Length must be a power
+ * of 2 and a multiple of the page size. The ring works with all the ring.h
+ * functions but must be freed with clean_mirrored().
+ */
+
+#ifndef RING_MIRROR_H
+#define RING_MIRROR_H
+
+#include "ring.h"
+
+ring_t* init_mirrored(size_t length);
+void clean_mirrored(ring_t *ring);
+
+#endif
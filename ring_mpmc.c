@@ -0,0 +1,154 @@
+/*******************************************************************************
+ *
+ * Copyright (C) 2026 by the ring buffer contributors
+ *
+ ******************************************************************************/
+
+/*
+ * @file ring_mpmc.c
+ * @brief Library definitions for a bounded multi-producer/multi-consumer
+ *        ring buffer.
+ *
+ * @date October 16, 2026
+ *
+ * ATTRIBUTIONS
+ * Algorithm is Dmitry Vyukov's bounded MPMC queue:
+ * https://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue
+ */
+
+#include "ring_mpmc.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+mpmc_ring_t* mpmc_init(size_t length)
+{
+    // Confirm length is a power of 2.
+    if (!((length != 0) && !(length & (length - 1))))
+    {
+        printf("mpmc_init(): ERROR: Length of ring must be a power of 2.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    // Alloc and verify ring.
+    mpmc_ring_t *ring = aligned_alloc(RING_CACHE_LINE, sizeof(mpmc_ring_t));
+    if (ring == NULL)
+    {
+        printf("mpmc_init(): ERROR: Ring is NULL.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    // Alloc and verify slots.
+    ring->Slots = malloc(length * sizeof(mpmc_slot_t));
+    if (ring->Slots == NULL)
+    {
+        printf("mpmc_init(): ERROR: Ring buffer is NULL.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    // Set ring parameters. Every slot starts free for its first position.
+    ring->Length = length;
+    ring->Adj_Len = length - 1;
+    atomic_init(&ring->Ini, 0);
+    atomic_init(&ring->Outi, 0);
+    for (size_t i = 0; i < length; i++)
+    {
+        atomic_init(&ring->Slots[i].Seq, i);
+    }
+
+    // Return ring.
+    return ring;
+}
+
+int mpmc_insert(mpmc_ring_t *ring, char data)
+{
+    size_t pos = atomic_load_explicit(&ring->Ini, memory_order_relaxed);
+    mpmc_slot_t *slot;
+
+    for (;;)
+    {
+        slot = &ring->Slots[pos & ring->Adj_Len];
+        size_t seq = atomic_load_explicit(&slot->Seq, memory_order_acquire);
+        intptr_t diff = (intptr_t)(seq - pos);
+
+        if (diff == 0)
+        {
+            // Slot is free; try to claim the position.
+            if (atomic_compare_exchange_weak_explicit(&ring->Ini, &pos,
+                    pos + 1, memory_order_relaxed, memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            return 0; // full: slot still holds data from a lap ago
+        }
+        else
+        {
+            // Another producer claimed this position; catch up.
+            pos = atomic_load_explicit(&ring->Ini, memory_order_relaxed);
+        }
+    }
+
+    // Fill the slot, then hand it to the consumer that claims pos.
+    slot->Data = data;
+    atomic_store_explicit(&slot->Seq, pos + 1, memory_order_release);
+    return 1;
+}
+
+int mpmc_remove(mpmc_ring_t *ring, char *data)
+{
+    size_t pos = atomic_load_explicit(&ring->Outi, memory_order_relaxed);
+    mpmc_slot_t *slot;
+
+    for (;;)
+    {
+        slot = &ring->Slots[pos & ring->Adj_Len];
+        size_t seq = atomic_load_explicit(&slot->Seq, memory_order_acquire);
+        intptr_t diff = (intptr_t)(seq - (pos + 1));
+
+        if (diff == 0)
+        {
+            // Slot holds data; try to claim the position.
+            if (atomic_compare_exchange_weak_explicit(&ring->Outi, &pos,
+                    pos + 1, memory_order_relaxed, memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            return 0; // empty: slot not filled yet
+        }
+        else
+        {
+            // Another consumer claimed this position; catch up.
+            pos = atomic_load_explicit(&ring->Outi, memory_order_relaxed);
+        }
+    }
+
+    // Empty the slot, then free it for the producer one lap ahead.
+    *data = slot->Data;
+    atomic_store_explicit(&slot->Seq, pos + ring->Length,
+                          memory_order_release);
+    return 1;
+}
+
+// Approximate while producers/consumers are running.
+size_t mpmc_entries(mpmc_ring_t *ring)
+{
+    size_t outi = atomic_load_explicit(&ring->Outi, memory_order_acquire);
+    size_t ini = atomic_load_explicit(&ring->Ini, memory_order_acquire);
+    return (ini - outi);
+}
+
+void mpmc_clean(mpmc_ring_t *ring)
+{
+    if (ring == NULL) { return; }
+
+    // Free memory.
+    free(ring->Slots);
+    ring->Slots = NULL;
+    free(ring);
+}
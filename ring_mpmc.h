@@ -0,0 +1,54 @@
+/*******************************************************************************
+ *
+ * Copyright (C) 2026 by the ring buffer contributors
+ *
+ ******************************************************************************/
+
+/*
+ * @file ring_mpmc.h
+ * @brief Library declarations for a bounded multi-producer/multi-consumer
+ *        ring buffer.
+ *
+ * @date October 16, 2026
+ */
+
+#ifndef RING_MPMC_H
+#define RING_MPMC_H
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include "ring.h"
+
+// Each slot carries a sequence number (Vyukov's bounded MPMC queue). A slot at
+// position pos is free for the producer that claims pos when Seq == pos, and
+// holds data for the consumer that claims pos when Seq == pos + 1. Producers
+// and consumers claim positions with a CAS on Ini/Outi, so any number of each
+// may run concurrently without locks. Positions are unsigned and wrap like
+// ring_t's; sequence comparisons use the signed difference.
+typedef struct
+{
+    atomic_size_t Seq;
+    char Data;
+} mpmc_slot_t;
+
+typedef struct
+{
+    // Shared, fixed after mpmc_init().
+    mpmc_slot_t *Slots;
+    size_t Length;
+    size_t Adj_Len;
+
+    // Claimed by producers.
+    _Alignas(RING_CACHE_LINE) atomic_size_t Ini;
+
+    // Claimed by consumers.
+    _Alignas(RING_CACHE_LINE) atomic_size_t Outi;
+} mpmc_ring_t;
+
+mpmc_ring_t* mpmc_init(size_t length);
+int mpmc_insert(mpmc_ring_t *ring, char data);
+int mpmc_remove(mpmc_ring_t *ring, char *data);
+size_t mpmc_entries(mpmc_ring_t *ring);
+void mpmc_clean(mpmc_ring_t *ring);
+
+#endif
@@ -0,0 +1,109 @@
+/*******************************************************************************
+ *
+ * Copyright (C) 2026 by the ring buffer contributors
+ *
+ ******************************************************************************/
+
+/*
+ * @file ring_msg.c
+ * @brief Library definitions for a variable-size message queue on a ring_t.
+ *
+ * @date October 16, 2026
+ */
+
+#include "ring_msg.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Producer: queue the len bytes at msg as one message. Returns 1 on success,
+// 0 if the ring has no room for it yet or it can never fit.
+int ring_msg_send(ring_t *ring, const char *msg, size_t len)
+{
+    // Verify.
+    if (!is_ring_valid(ring) || !is_ring_buffer_valid(ring))
+    { exit(EXIT_FAILURE); }
+
+    size_t need = RING_MSG_SIZE(len);
+    if (len >= RING_MSG_PAD || need > ring->Length)
+    {
+        printf("ring_msg_send(): ERROR: Message does not fit in the ring.\n");
+        return 0;
+    }
+
+    char *ptr;
+    size_t span = ring_reserve(ring, ring->Length, &ptr);
+    if (span < need)
+    {
+        // Too little room before the wrap point. If all of it is free, fill
+        // it with a padding record and try again from the start of the buffer.
+        size_t ini = atomic_load_explicit(&ring->Ini, memory_order_relaxed);
+        size_t to_end = (ring->Flags & RING_F_MIRRORED) ? ring->Length
+                        : ring->Length - (ini & ring->Adj_Len);
+        if (span < to_end) { return 0; }
+
+        uint32_t pad = RING_MSG_PAD;
+        memcpy(ptr, &pad, sizeof(pad));
+        ring_commit(ring, to_end);
+
+        span = ring_reserve(ring, need, &ptr);
+        if (span < need) { return 0; }
+    }
+
+    // Write the whole record, then publish it.
+    uint32_t hdr = len;
+    memcpy(ptr, &hdr, sizeof(hdr));
+    memcpy(ptr + sizeof(hdr), msg, len);
+    ring_commit(ring, need);
+    return 1;
+}
+
+// Consumer: get the next message in place, skipping padding. Returns 1 and
+// points *msg at its payload and sets *len, or returns 0 if the ring is
+// empty. The message stays in the ring until ring_msg_release().
+int ring_msg_peek(ring_t *ring, char **msg, size_t *len)
+{
+    for (;;)
+    {
+        char *ptr;
+        size_t avail = ring_peek(ring, &ptr);
+        if (avail == 0) { return 0; }
+
+        uint32_t hdr;
+        memcpy(&hdr, ptr, sizeof(hdr));
+        if (hdr == RING_MSG_PAD)
+        {
+            // Padding runs to the wrap point, which is where the span ends.
+            ring_consume(ring, avail);
+            continue;
+        }
+
+        *msg = ptr + sizeof(hdr);
+        *len = hdr;
+        return 1;
+    }
+}
+
+// Consumer: drop the message returned by ring_msg_peek().
+void ring_msg_release(ring_t *ring)
+{
+    char *ptr;
+    uint32_t hdr;
+    ring_peek(ring, &ptr);
+    memcpy(&hdr, ptr, sizeof(hdr));
+    ring_consume(ring, RING_MSG_SIZE(hdr));
+}
+
+// Consumer: copy the next message into dst, which holds max bytes. Returns 1
+// and sets *len on success. Returns 0 if the ring is empty, or if the message
+// is larger than max, in which case *len is its length and it stays queued.
+int ring_msg_recv(ring_t *ring, char *dst, size_t max, size_t *len)
+{
+    char *msg;
+    if (!ring_msg_peek(ring, &msg, len)) { return 0; }
+    if (*len > max) { return 0; }
+
+    memcpy(dst, msg, *len);
+    ring_msg_release(ring);
+    return 1;
+}
@@ -0,0 +1,41 @@
+/*******************************************************************************
+ *
+ * Copyright (C) 2026 by the ring buffer contributors
+ *
+ ******************************************************************************/
+
+/*
+ * @file ring_msg.h
+ * @brief Library declarations for a variable-size message queue on a ring_t.
+ *
+ * @date October 16, 2026
+ *
+ * Each message is stored as a record: a uint32_t length, then the payload,
+ * padded to RING_MSG_ALIGN. The producer writes a record into a reserved span
+ * and commits it in one go, so the consumer never sees part of a record.
+ * Records do not wrap. When one would not fit before the end of the buffer,
+ * the rest of the buffer becomes a padding record (length RING_MSG_PAD) that
+ * the consumer skips. A mirrored ring (ring_mirror.h) never needs padding.
+ * Use the ring only through these calls, with one producer and one consumer,
+ * and not in overwrite mode.
+ */
+
+#ifndef RING_MSG_H
+#define RING_MSG_H
+
+#include <stdint.h>
+#include "ring.h"
+
+#define RING_MSG_ALIGN sizeof(uint32_t)
+#define RING_MSG_PAD UINT32_MAX // length of a padding record
+
+// Ring bytes taken by a message of len bytes.
+#define RING_MSG_SIZE(len) \
+    ((sizeof(uint32_t) + (len) + RING_MSG_ALIGN - 1) & ~(RING_MSG_ALIGN - 1))
+
+int ring_msg_send(ring_t *ring, const char *msg, size_t len);
+int ring_msg_peek(ring_t *ring, char **msg, size_t *len);
+void ring_msg_release(ring_t *ring);
+int ring_msg_recv(ring_t *ring, char *dst, size_t max, size_t *len);
+
+#endif
@@ -0,0 +1,143 @@
+/*******************************************************************************
+ *
+ * Copyright (C) 2026 by the ring buffer contributors
+ *
+ ******************************************************************************/
+
+/*
+ * @file ring_pi.c
+ * @brief Library definitions for a position-independent SPSC ring.
+ *
+ * @date October 16, 2026
+ */
+
+#include "ring_pi.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Lay out an empty ring of length chars (a power of 2) in mem, which must be
+// cache-line aligned and hold PI_RING_SIZE(length) bytes. Returns the ring, or
+// NULL if the indices would not be lock-free (and so not safe to share
+// between processes).
+pi_ring_t* pi_ring_format(void *mem, size_t length)
+{
+    // Confirm length is a power of 2.
+    if (!((length != 0) && !(length & (length - 1))))
+    {
+        printf("pi_ring_format(): ERROR: Length of ring must be a power of "
+               "2.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    pi_ring_t *ring = mem;
+    if (!atomic_is_lock_free(&ring->Ini))
+    {
+        printf("pi_ring_format(): ERROR: Indices are not lock-free.\n");
+        return NULL;
+    }
+
+    // Set ring parameters.
+    ring->Version = PI_RING_VERSION;
+    ring->Length = length;
+    ring->Adj_Len = length - 1;
+    ring->Buffer_Off = sizeof(pi_ring_t);
+    atomic_init(&ring->Ini, 0);
+    atomic_init(&ring->Outi, 0);
+    ring->Outi_Cache = 0;
+    ring->Ini_Cache = 0;
+
+    // Write the magic last, so a half formatted ring never passes the check.
+    atomic_thread_fence(memory_order_release);
+    ring->Magic = PI_RING_MAGIC;
+    return ring;
+}
+
+// Check that the size bytes at mem hold a formatted ring. Returns the ring, or
+// NULL if the header is missing or does not fit in size.
+pi_ring_t* pi_ring_check(void *mem, size_t size)
+{
+    pi_ring_t *ring = mem;
+    if (size < sizeof(pi_ring_t) || ring->Magic != PI_RING_MAGIC ||
+        ring->Version != PI_RING_VERSION)
+    {
+        printf("pi_ring_check(): ERROR: No ring found.\n");
+        return NULL;
+    }
+    if (ring->Length == 0 || (ring->Length & ring->Adj_Len) ||
+        ring->Adj_Len != ring->Length - 1 ||
+        ring->Buffer_Off != sizeof(pi_ring_t) ||
+        ring->Length > size - sizeof(pi_ring_t))
+    {
+        printf("pi_ring_check(): ERROR: Ring header is corrupt.\n");
+        return NULL;
+    }
+    return ring;
+}
+
+// Producer: insert up to n bytes from src with at most two copies and a single
+// publish of Ini. Returns the number of bytes inserted.
+size_t pi_insert_n(pi_ring_t *ring, const char *src, size_t n)
+{
+    size_t ini = atomic_load_explicit(&ring->Ini, memory_order_relaxed);
+
+    // Only reload Outi when the cached copy does not leave enough room.
+    size_t space = ring->Length - (ini - ring->Outi_Cache);
+    if (space < n)
+    {
+        ring->Outi_Cache = atomic_load_explicit(&ring->Outi,
+                                                memory_order_acquire);
+        space = ring->Length - (ini - ring->Outi_Cache);
+    }
+    if (n > space) { n = space; }
+    if (n == 0) { return 0; }
+
+    // Copy up to the end of the buffer, then the rest from the start.
+    char *buffer = pi_buffer(ring);
+    size_t start = ini & ring->Adj_Len;
+    size_t first = ring->Length - start;
+    if (first > n) { first = n; }
+    memcpy(buffer + start, src, first);
+    memcpy(buffer, src + first, n - first);
+
+    atomic_store_explicit(&ring->Ini, ini + n, memory_order_release);
+    return n;
+}
+
+// Consumer: remove up to n bytes into dst with at most two copies and a single
+// publish of Outi. Returns the number of bytes removed.
+size_t pi_remove_n(pi_ring_t *ring, char *dst, size_t n)
+{
+    size_t outi = atomic_load_explicit(&ring->Outi, memory_order_relaxed);
+
+    // Only reload Ini when the cached copy does not hold enough bytes.
+    size_t avail = ring->Ini_Cache - outi;
+    if (avail < n)
+    {
+        ring->Ini_Cache = atomic_load_explicit(&ring->Ini,
+                                               memory_order_acquire);
+        avail = ring->Ini_Cache - outi;
+    }
+    if (n > avail) { n = avail; }
+    if (n == 0) { return 0; }
+
+    // Copy up to the end of the buffer, then the rest from the start.
+    char *buffer = pi_buffer(ring);
+    size_t start = outi & ring->Adj_Len;
+    size_t first = ring->Length - start;
+    if (first > n) { first = n; }
+    memcpy(dst, buffer + start, first);
+    memcpy(dst + first, buffer, n - first);
+
+    atomic_store_explicit(&ring->Outi, outi + n, memory_order_release);
+    return n;
+}
+
+size_t pi_entries(pi_ring_t *ring)
+{
+    // Load Outi first so a concurrent producer can only make the count
+    // larger, never negative.
+    size_t outi = atomic_load_explicit(&ring->Outi, memory_order_acquire);
+    size_t ini = atomic_load_explicit(&ring->Ini, memory_order_acquire);
+    return (ini - outi);
+}
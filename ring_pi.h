@@ -0,0 +1,67 @@
+/*******************************************************************************
+ *
+ * Copyright (C) 2026 by the ring buffer contributors
+ *
+ ******************************************************************************/
+
+/*
+ * @file ring_pi.h
+ * @brief Library declarations for a position-independent SPSC ring, for rings
+ *        that live in memory mapped by more than one process.
+ *
+ * @date October 16, 2026
+ *
+ * A pi_ring_t and its buffer sit in one block of memory: the header first,
+ * then the buffer at Buffer_Off bytes from the header. The header holds no
+ * pointers, so the block may be mapped at a different address in each process
+ * (see ring_shm.h) or saved to a file. The indices follow the ring_t rules:
+ * unsigned and wrapping, Ini written only by the producer and Outi only by the
+ * consumer, each published with release and read with acquire. Each side's
+ * cached copy of the other side's index sits on that side's own cache line.
+ */
+
+#ifndef RING_PI_H
+#define RING_PI_H
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "ring.h"
+
+#define PI_RING_MAGIC 0x52494E47u // "RING"
+#define PI_RING_VERSION 1u
+
+typedef struct
+{
+    // Shared, fixed after pi_ring_format().
+    uint32_t Magic;
+    uint32_t Version;
+    size_t Length;
+    size_t Adj_Len;
+    size_t Buffer_Off; // buffer starts this many bytes after the header
+
+    // Producer side.
+    _Alignas(RING_CACHE_LINE) atomic_size_t Ini;
+    size_t Outi_Cache;
+
+    // Consumer side.
+    _Alignas(RING_CACHE_LINE) atomic_size_t Outi;
+    size_t Ini_Cache;
+} pi_ring_t;
+
+// Bytes of memory a ring of length chars needs, header included.
+#define PI_RING_SIZE(length) (sizeof(pi_ring_t) + (length))
+
+pi_ring_t* pi_ring_format(void *mem, size_t length);
+pi_ring_t* pi_ring_check(void *mem, size_t size);
+size_t pi_insert_n(pi_ring_t *ring, const char *src, size_t n);
+size_t pi_remove_n(pi_ring_t *ring, char *dst, size_t n);
+size_t pi_entries(pi_ring_t *ring);
+
+// The buffer, at its offset from the header.
+static inline char* pi_buffer(pi_ring_t *ring)
+{
+    return (char *)ring + ring->Buffer_Off;
+}
+
+#endif
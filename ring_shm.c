@@ -0,0 +1,96 @@
+/*******************************************************************************
+ *
+ * Copyright (C) 2026 by the ring buffer contributors
+ *
+ ******************************************************************************/
+
+/*
+ * @file ring_shm.c
+ * @brief Library definitions for rings in POSIX shared memory.
+ *
+ * @date October 16, 2026
+ */
+
+#include "ring_shm.h"
+#include <stdio.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Map size bytes of fd shared. Returns NULL on failure. The mapping keeps the
+// object alive, so fd is always closed.
+static void* map_shared(int fd, size_t size)
+{
+    void *mem = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    return (mem == MAP_FAILED) ? NULL : mem;
+}
+
+// Create the shared-memory object name (e.g. "/uart_rx") holding an empty ring
+// of length chars (a power of 2). Fails if name already exists. Returns NULL
+// on failure.
+pi_ring_t* shm_ring_create(const char *name, size_t length)
+{
+    int fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd < 0)
+    {
+        printf("shm_ring_create(): ERROR: Cannot create %s.\n", name);
+        return NULL;
+    }
+
+    size_t size = PI_RING_SIZE(length);
+    if (ftruncate(fd, size) != 0)
+    {
+        close(fd);
+        shm_unlink(name);
+        return NULL;
+    }
+
+    void *mem = map_shared(fd, size);
+    pi_ring_t *ring = (mem == NULL) ? NULL : pi_ring_format(mem, length);
+    if (ring == NULL)
+    {
+        if (mem != NULL) { munmap(mem, size); }
+        shm_unlink(name);
+    }
+    return ring;
+}
+
+// Map the ring in the existing shared-memory object name. Returns NULL if it
+// does not exist or does not hold a ring.
+pi_ring_t* shm_ring_attach(const char *name)
+{
+    int fd = shm_open(name, O_RDWR, 0);
+    if (fd < 0)
+    {
+        printf("shm_ring_attach(): ERROR: Cannot open %s.\n", name);
+        return NULL;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(pi_ring_t))
+    {
+        close(fd);
+        return NULL;
+    }
+
+    size_t size = st.st_size;
+    void *mem = map_shared(fd, size);
+    if (mem == NULL) { return NULL; }
+    pi_ring_t *ring = pi_ring_check(mem, size);
+    if (ring == NULL) { munmap(mem, size); }
+    return ring;
+}
+
+// Unmap this process's view of the ring. The ring stays in shared memory.
+void shm_ring_detach(pi_ring_t *ring)
+{
+    munmap(ring, PI_RING_SIZE(ring->Length));
+}
+
+// Remove name; the memory goes away once every process has detached.
+int shm_ring_unlink(const char *name)
+{
+    return shm_unlink(name) == 0;
+}
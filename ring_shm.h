@@ -0,0 +1,30 @@
+/*******************************************************************************
+ *
+ * Copyright (C) 2026 by the ring buffer contributors
+ *
+ ******************************************************************************/
+
+/*
+ * @file ring_shm.h
+ * @brief Library declarations for rings in POSIX shared memory, shared between
+ *        processes (Linux/POSIX only).
+ *
+ * @date October 16, 2026
+ *
+ * One process creates the ring by name and the other attaches to it. Each one
+ * maps the same shared-memory object, maybe at different addresses, and uses
+ * the pi_ring_t calls from ring_pi.h: one process as producer, the other as
+ * consumer. Both detach when done, and the creator unlinks the name.
+ */
+
+#ifndef RING_SHM_H
+#define RING_SHM_H
+
+#include "ring_pi.h"
+
+pi_ring_t* shm_ring_create(const char *name, size_t length);
+pi_ring_t* shm_ring_attach(const char *name);
+void shm_ring_detach(pi_ring_t *ring);
+int shm_ring_unlink(const char *name);
+
+#endif
@@ -0,0 +1,369 @@
+/*******************************************************************************
+ *
+ * Copyright (C) 2026 by the ring buffer contributors
+ *
+ ******************************************************************************/
+
+/*
+ * @file ring_stats.c
+ * @brief Library definitions for optional per-ring counters.
+ *
+ * @date October 16, 2026
+ *
+ * NOTES:
+ * The seqlocks are built without fences. The writer stores an odd sequence,
+ * then stores each counter with release, so no counter store can be seen
+ * before the odd sequence. It then stores the next even sequence with
+ * release. The reader loads the sequence and each counter with acquire, so
+ * its second sequence load cannot move ahead of them. If the reader saw any
+ * counter from an update in progress, its second load sees the sequence moved
+ * and it retries. Only one thread writes each side, so a side needs no
+ * read-modify-write.
+ */
+
+#include "ring_stats.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#if defined(__ARM_ARCH_6M__) && !defined(__linux__)
+#include "MKL25Z4.h"
+
+// SysTick counts down at the core clock. Left free running from
+// RING_CLOCK_MASK, its complement counts up.
+static void clock_start(void)
+{
+    if (!(SysTick->CTRL & SysTick_CTRL_ENABLE_Msk))
+    {
+        SysTick->LOAD = RING_CLOCK_MASK;
+        SysTick->VAL = 0;
+        SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_ENABLE_Msk;
+    }
+}
+
+uint64_t ring_clock(void)
+{
+    return RING_CLOCK_MASK - SysTick->VAL;
+}
+#else
+#include <time.h>
+
+static void clock_start(void)
+{
+}
+
+uint64_t ring_clock(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+#endif
+
+// Histogram bucket for an occupancy of n.
+static size_t bucket(size_t n)
+{
+    size_t b = 0;
+    while (n) { n >>= 1; b++; }
+    return b;
+}
+
+// Latency histogram bucket for a wait of t ticks.
+static size_t lat_bucket(uint64_t t)
+{
+    if (t < RING_LAT_STEPS) { return t; }
+    size_t e = 0;
+    for (uint64_t v = t; v > 1; v >>= 1) { e++; }
+    return (e - 2) * RING_LAT_STEPS + ((t >> (e - 3)) & (RING_LAT_STEPS - 1));
+}
+
+// Largest wait counted by latency bucket b.
+static uint64_t lat_bucket_max(size_t b)
+{
+    if (b < RING_LAT_STEPS) { return b; }
+    size_t e = b / RING_LAT_STEPS + 2;
+    uint64_t step = (uint64_t)1 << (e - 3);
+    return (RING_LAT_STEPS + b % RING_LAT_STEPS) * step + step - 1;
+}
+
+// Add n to a counter only this thread writes.
+static void bump(atomic_size_t *counter, size_t n)
+{
+    size_t v = atomic_load_explicit(counter, memory_order_relaxed);
+    atomic_store_explicit(counter, v + n, memory_order_release);
+}
+
+// Attach zeroed counters to ring. Call before the ring is shared. Returns 1
+// on success.
+int ring_stats_enable(ring_t *ring)
+{
+    // Verify.
+    if (!is_ring_valid(ring)) { exit(EXIT_FAILURE); }
+    if (ring->Stats != NULL) { return 1; }
+
+    ring_stats_t *stats = aligned_alloc(RING_CACHE_LINE, sizeof(ring_stats_t));
+    if (stats == NULL) { return 0; }
+    atomic_init(&stats->Insert_Seq, 0);
+    atomic_init(&stats->Inserted, 0);
+    atomic_init(&stats->Failed_Inserts, 0);
+    atomic_init(&stats->Peak, 0);
+    for (size_t b = 0; b < RING_STATS_BUCKETS; b++)
+    {
+        atomic_init(&stats->Hist[b], 0);
+    }
+    stats->Stamps = NULL;
+    stats->Stamp_Mask = 0;
+    atomic_init(&stats->Stamp_In, 0);
+    stats->Stamp_Out_Cache = 0;
+    atomic_init(&stats->Remove_Seq, 0);
+    atomic_init(&stats->Removed, 0);
+    atomic_init(&stats->Failed_Removes, 0);
+    atomic_init(&stats->Stamp_Out, 0);
+    for (size_t b = 0; b < RING_LAT_BUCKETS; b++)
+    {
+        atomic_init(&stats->Lat_Hist[b], 0);
+    }
+
+    ring->Stats = stats;
+    return 1;
+}
+
+// Enable the counters (if they are not already) and latency stamps. Call
+// before the ring is shared. Returns 1 on success.
+int ring_stats_enable_latency(ring_t *ring)
+{
+    if (!ring_stats_enable(ring)) { return 0; }
+    ring_stats_t *stats = ring->Stats;
+    if (stats->Stamps != NULL) { return 1; }
+
+    // At most one stamp per entry in the ring, plus slack for stamps the
+    // consumer has not yet collected.
+    size_t length = 2 * ring->Length;
+    stats->Stamps = malloc(length * sizeof(ring_stamp_t));
+    if (stats->Stamps == NULL) { return 0; }
+    stats->Stamp_Mask = length - 1;
+    clock_start();
+    return 1;
+}
+
+// Detach and free the counters. Call when the ring is not in use.
+void ring_stats_disable(ring_t *ring)
+{
+    // Verify.
+    if (!is_ring_valid(ring)) { exit(EXIT_FAILURE); }
+
+    if (ring->Stats != NULL) { free(ring->Stats->Stamps); }
+    free(ring->Stats);
+    ring->Stats = NULL;
+}
+
+// Rebase the latency stamps for ring_resize(), which moves Outi to 0, and size
+// their queue for a ring of length chars. Only while no other thread uses the
+// ring. Returns 1 on success, 0 if the new queue cannot be allocated.
+int ring_stats_resize(ring_t *ring, size_t length)
+{
+    ring_stats_t *stats = ring->Stats;
+    if (stats == NULL || stats->Stamps == NULL) { return 1; }
+
+    size_t cap = 2 * length;
+    ring_stamp_t *stamps = malloc(cap * sizeof(ring_stamp_t));
+    if (stamps == NULL) { return 0; }
+
+    // Keep the stamps of live entries, in order. There is at most one per
+    // entry, so they fit.
+    size_t outi = atomic_load_explicit(&ring->Outi, memory_order_relaxed);
+    size_t out = atomic_load_explicit(&stats->Stamp_Out, memory_order_relaxed);
+    size_t in = atomic_load_explicit(&stats->Stamp_In, memory_order_relaxed);
+    size_t kept = 0;
+    for (; out != in && kept < cap; out++)
+    {
+        ring_stamp_t *stamp = &stats->Stamps[out & stats->Stamp_Mask];
+        if ((intptr_t)(stamp->Index - outi) < 0) { continue; }
+        stamps[kept] = *stamp;
+        stamps[kept].Index -= outi;
+        kept++;
+    }
+
+    free(stats->Stamps);
+    stats->Stamps = stamps;
+    stats->Stamp_Mask = cap - 1;
+    atomic_store_explicit(&stats->Stamp_In, kept, memory_order_relaxed);
+    atomic_store_explicit(&stats->Stamp_Out, 0, memory_order_relaxed);
+    stats->Stamp_Out_Cache = 0;
+    return 1;
+}
+
+// Producer: queue a stamp for the entry at index, unless the queue is full.
+static void stamp_insert(ring_stats_t *stats, size_t index)
+{
+    size_t in = atomic_load_explicit(&stats->Stamp_In, memory_order_relaxed);
+    if (in - stats->Stamp_Out_Cache > stats->Stamp_Mask)
+    {
+        stats->Stamp_Out_Cache = atomic_load_explicit(&stats->Stamp_Out,
+                                                      memory_order_acquire);
+        if (in - stats->Stamp_Out_Cache > stats->Stamp_Mask) { return; }
+    }
+
+    ring_stamp_t *stamp = &stats->Stamps[in & stats->Stamp_Mask];
+    stamp->Index = index;
+    stamp->Time = ring_clock();
+    atomic_store_explicit(&stats->Stamp_In, in + 1, memory_order_release);
+}
+
+// Consumer: take out the stamps of every entry before outi and count how long
+// each one waited.
+static void stamp_remove(ring_stats_t *stats, size_t outi)
+{
+    size_t out = atomic_load_explicit(&stats->Stamp_Out, memory_order_relaxed);
+    size_t in = atomic_load_explicit(&stats->Stamp_In, memory_order_acquire);
+    uint64_t now = ring_clock();
+
+    for (; out != in; out++)
+    {
+        ring_stamp_t *stamp = &stats->Stamps[out & stats->Stamp_Mask];
+        if ((intptr_t)(outi - stamp->Index) <= 0) { break; }
+        uint64_t wait = (now - stamp->Time) & RING_CLOCK_MASK;
+        bump(&stats->Lat_Hist[lat_bucket(wait)], 1);
+    }
+    atomic_store_explicit(&stats->Stamp_Out, out, memory_order_release);
+}
+
+// Producer hook, see ring_notify_insert(): count n inserted bytes, or a
+// failed insert if n is 0, and sample the occupancy.
+void ring_stats_insert(ring_t *ring, size_t n)
+{
+    ring_stats_t *stats = ring->Stats;
+    size_t outi = atomic_load_explicit(&ring->Outi, memory_order_relaxed);
+    size_t ini = atomic_load_explicit(&ring->Ini, memory_order_relaxed);
+    size_t used = ini - outi;
+
+    unsigned seq = atomic_load_explicit(&stats->Insert_Seq,
+                                        memory_order_relaxed);
+    atomic_store_explicit(&stats->Insert_Seq, seq + 1, memory_order_relaxed);
+    if (n) { bump(&stats->Inserted, n); }
+    else { bump(&stats->Failed_Inserts, 1); }
+    if (used > atomic_load_explicit(&stats->Peak, memory_order_relaxed))
+    {
+        atomic_store_explicit(&stats->Peak, used, memory_order_release);
+    }
+    bump(&stats->Hist[bucket(used)], 1);
+    if (n && stats->Stamps) { stamp_insert(stats, ini - n); }
+    atomic_store_explicit(&stats->Insert_Seq, seq + 2, memory_order_release);
+}
+
+// Consumer hook, see ring_notify_remove(): count n removed bytes, or a failed
+// remove if n is 0.
+void ring_stats_remove(ring_t *ring, size_t n)
+{
+    ring_stats_t *stats = ring->Stats;
+    unsigned seq = atomic_load_explicit(&stats->Remove_Seq,
+                                        memory_order_relaxed);
+    atomic_store_explicit(&stats->Remove_Seq, seq + 1, memory_order_relaxed);
+    if (n) { bump(&stats->Removed, n); }
+    else { bump(&stats->Failed_Removes, 1); }
+    if (n && stats->Stamps)
+    {
+        stamp_remove(stats, atomic_load_explicit(&ring->Outi,
+                                                 memory_order_relaxed));
+    }
+    atomic_store_explicit(&stats->Remove_Seq, seq + 2, memory_order_release);
+}
+
+// Copy the counters into snap, each side consistent with itself. All zero if
+// stats are off.
+void ring_stats_snapshot(ring_t *ring, ring_stats_snapshot_t *snap)
+{
+    // Verify.
+    if (!is_ring_valid(ring)) { exit(EXIT_FAILURE); }
+
+    *snap = (ring_stats_snapshot_t){0};
+    ring_stats_t *stats = ring->Stats;
+    if (stats == NULL) { return; }
+
+    unsigned seq;
+    do
+    {
+        seq = atomic_load_explicit(&stats->Insert_Seq, memory_order_acquire);
+        snap->Inserted = atomic_load_explicit(&stats->Inserted,
+                                              memory_order_acquire);
+        snap->Failed_Inserts = atomic_load_explicit(&stats->Failed_Inserts,
+                                                    memory_order_acquire);
+        snap->Peak = atomic_load_explicit(&stats->Peak, memory_order_acquire);
+        for (size_t b = 0; b < RING_STATS_BUCKETS; b++)
+        {
+            snap->Hist[b] = atomic_load_explicit(&stats->Hist[b],
+                                                 memory_order_acquire);
+        }
+    } while ((seq & 1) ||
+             seq != atomic_load_explicit(&stats->Insert_Seq,
+                                         memory_order_relaxed));
+
+    do
+    {
+        seq = atomic_load_explicit(&stats->Remove_Seq, memory_order_acquire);
+        snap->Removed = atomic_load_explicit(&stats->Removed,
+                                             memory_order_acquire);
+        snap->Failed_Removes = atomic_load_explicit(&stats->Failed_Removes,
+                                                    memory_order_acquire);
+        for (size_t b = 0; b < RING_LAT_BUCKETS; b++)
+        {
+            snap->Lat_Hist[b] = atomic_load_explicit(&stats->Lat_Hist[b],
+                                                     memory_order_acquire);
+        }
+    } while ((seq & 1) ||
+             seq != atomic_load_explicit(&stats->Remove_Seq,
+                                         memory_order_relaxed));
+}
+
+// Wait, in ring_clock() ticks, that pct % of the timed entries did not
+// exceed, e.g. pct = 99.9 for p999. Rounded up to the end of its histogram
+// bucket. 0 if nothing was timed.
+uint64_t ring_stats_percentile(const ring_stats_snapshot_t *snap, double pct)
+{
+    size_t total = 0;
+    for (size_t b = 0; b < RING_LAT_BUCKETS; b++)
+    {
+        total += snap->Lat_Hist[b];
+    }
+    if (total == 0) { return 0; }
+
+    // Rank of the entry we want, counting from 1: pct % of total rounded up,
+    // ignoring rounding error (99.9 % of 1000 is 999, not 1000).
+    double exact = pct / 100 * total - 1e-9;
+    size_t rank = (size_t)exact;
+    if (rank < exact) { rank++; }
+    if (rank == 0) { rank = 1; }
+
+    size_t seen = 0;
+    for (size_t b = 0; b < RING_LAT_BUCKETS; b++)
+    {
+        seen += snap->Lat_Hist[b];
+        if (seen >= rank) { return lat_bucket_max(b); }
+    }
+    return lat_bucket_max(RING_LAT_BUCKETS - 1);
+}
+
+// For debugging.
+void ring_stats_show(ring_t *ring)
+{
+    ring_stats_snapshot_t snap;
+    ring_stats_snapshot(ring, &snap);
+
+    printf("Inserted: %zu (failed %zu), removed: %zu (failed %zu), "
+           "peak: %zu of %zu\n", snap.Inserted, snap.Failed_Inserts,
+           snap.Removed, snap.Failed_Removes, snap.Peak, ring->Length);
+    for (size_t b = 0; b < RING_STATS_BUCKETS; b++)
+    {
+        if (snap.Hist[b] == 0) { continue; }
+        size_t lo = b ? (size_t)1 << (b - 1) : 0;
+        size_t hi = b ? ((size_t)1 << (b - 1)) * 2 - 1 : 0;
+        printf("  entries %zu..%zu: %zu\n", lo, hi, snap.Hist[b]);
+    }
+    if (ring->Stats != NULL && ring->Stats->Stamps != NULL)
+    {
+        printf("Wait (ticks): p50 %llu, p99 %llu, p999 %llu\n",
+               (unsigned long long)ring_stats_percentile(&snap, 50),
+               (unsigned long long)ring_stats_percentile(&snap, 99),
+               (unsigned long long)ring_stats_percentile(&snap, 99.9));
+    }
+}
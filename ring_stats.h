@@ -0,0 +1,112 @@
+/*******************************************************************************
+ *
+ * Copyright (C) 2026 by the ring buffer contributors
+ *
+ ******************************************************************************/
+
+/*
+ * @file ring_stats.h
+ * @brief Library declarations for optional per-ring counters.
+ *
+ * @date October 16, 2026
+ *
+ * ring_stats_enable() attaches counters to a ring. Every insert and remove
+ * call then updates them, including the lock-free and RING_DEFINE() paths:
+ *   producer: bytes inserted, failed inserts, peak entries() and a log2
+ *             histogram of entries() after each insert call
+ *   consumer: bytes removed, failed removes
+ * Each side writes only its own counters, on its own cache line, and wraps
+ * each update in a sequence count (a seqlock). ring_stats_snapshot() may run
+ * on any thread and retries until it gets a consistent copy of each side.
+ * An insert costs two sequence stores, a few counter stores and one relaxed
+ * load of Outi for the occupancy; with stats off it costs one NULL test.
+ *
+ * ring_stats_enable_latency() also times how long entries wait in the ring.
+ * Each insert call records one (index, ring_clock()) stamp for the first entry
+ * of its batch in a side queue. The remove call that consumes that entry
+ * takes the stamp out and adds the wait to a log-linear histogram (8 steps
+ * per power of 2, so within 12.5%). ring_stats_percentile() reads p50, p99
+ * or p999 from a snapshot. ring_clock() counts CLOCK_MONOTONIC nanoseconds
+ * on the host and core clocks from a free-running SysTick on the KL25Z.
+ */
+
+#ifndef RING_STATS_H
+#define RING_STATS_H
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "ring.h"
+
+// Bucket 0 counts an empty ring, bucket b > 0 an occupancy in
+// [2^(b-1), 2^b).
+#define RING_STATS_BUCKETS (sizeof(size_t) * 8 + 1)
+
+// Latency bucket i < 8 counts a wait of i ticks. Above that, each power of 2
+// is split into 8 equal steps.
+#define RING_LAT_STEPS 8
+#define RING_LAT_BUCKETS ((64 - 2) * RING_LAT_STEPS)
+
+// ring_clock() ticks wrap at this mask: 24-bit SysTick on the target, 64-bit
+// nanoseconds on the host. Waits longer than one wrap are not measured
+// correctly.
+#if defined(__ARM_ARCH_6M__) && !defined(__linux__)
+#define RING_CLOCK_MASK 0xFFFFFFu
+#else
+#define RING_CLOCK_MASK UINT64_MAX
+#endif
+
+// Stamp for the first entry of one insert call.
+typedef struct
+{
+    size_t Index; // ring index of the entry
+    uint64_t Time; // ring_clock() just after it was published
+} ring_stamp_t;
+
+typedef struct ring_stats_s
+{
+    // Producer side.
+    _Alignas(RING_CACHE_LINE) atomic_uint Insert_Seq; // odd while updating
+    atomic_size_t Inserted;
+    atomic_size_t Failed_Inserts;
+    atomic_size_t Peak;
+    atomic_size_t Hist[RING_STATS_BUCKETS];
+
+    // Latency stamps, NULL unless ring_stats_enable_latency(). A side queue
+    // with the same SPSC rules as the ring; full means the stamp is skipped.
+    ring_stamp_t *Stamps;
+    size_t Stamp_Mask;
+    atomic_size_t Stamp_In;
+    size_t Stamp_Out_Cache; // producer's last view of Stamp_Out
+
+    // Consumer side.
+    _Alignas(RING_CACHE_LINE) atomic_uint Remove_Seq; // odd while updating
+    atomic_size_t Removed;
+    atomic_size_t Failed_Removes;
+    atomic_size_t Stamp_Out;
+    atomic_size_t Lat_Hist[RING_LAT_BUCKETS];
+} ring_stats_t;
+
+// A consistent copy of the counters.
+typedef struct
+{
+    size_t Inserted;
+    size_t Failed_Inserts;
+    size_t Peak;
+    size_t Hist[RING_STATS_BUCKETS];
+    size_t Removed;
+    size_t Failed_Removes;
+    size_t Lat_Hist[RING_LAT_BUCKETS];
+} ring_stats_snapshot_t;
+
+int ring_stats_enable(ring_t *ring);
+int ring_stats_enable_latency(ring_t *ring);
+void ring_stats_disable(ring_t *ring);
+int ring_stats_resize(ring_t *ring, size_t length);
+void ring_stats_snapshot(ring_t *ring, ring_stats_snapshot_t *snap);
+void ring_stats_show(ring_t *ring);
+uint64_t ring_stats_percentile(const ring_stats_snapshot_t *snap,
+                               double pct);
+uint64_t ring_clock(void);
+
+#endif
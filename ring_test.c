@@ -19,11 +19,82 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <sched.h>
+#include <signal.h>
+#include <unistd.h>
+#include <poll.h>
+#include <sys/epoll.h>
+#include <sys/wait.h>
 #include "ring.h"
+#include "ring_trace.h"
+#include "ring_mpmc.h"
+#include "ring_mirror.h"
+#include "ring_typed.h"
+#include "ring_wait.h"
+#include "ring_event.h"
+#include "ring_arena.h"
+#include "ring_shm.h"
+#include "ring_file.h"
+#include "ring_msg.h"
+#include "ring_bcast.h"
+#include "ring_stats.h"
+#include "ring_find.h"
+#include "ring_frame.h"
+#include "ring_hist.h"
 #include "CUnit/Basic.h"
 
 #define RING_LEN 4 // test suite 1
 #define MAX_NUM_RINGS 2  // test suite 2
+#define SPSC_RING_LEN 64 // test suite 3
+#define SPSC_NUM_BYTES (1 << 20) // test suite 3
+#define BULK_RING_LEN 8 // test suite 4
+#define STATIC_RING_LEN 4 // test suite 5
+#define MPMC_RING_LEN 16 // test suite 7
+#define MPMC_NUM_THREADS 4 // test suite 7 (producers, and consumers)
+#define MPMC_NUM_BYTES (1 << 16) // test suite 7, per producer
+#define MIRROR_RING_LEN 4096 // test suite 8, one page
+#define TYPED_RING_LEN 4 // test suite 9
+#define OVERWRITE_RING_LEN 4 // test suite 10
+#define OVERWRITE_THREAD_RING_LEN 16 // test suite 10
+#define OVERWRITE_NUM_BYTES (1 << 18) // test suite 10
+#define WRAP_RING_LEN 64 // test suite 11
+#define WRAP_NUM_BYTES (1 << 20) // test suite 11
+#define WAIT_RING_LEN 16 // test suite 12
+#define WAIT_NUM_BYTES (1 << 16) // test suite 12
+#define WAIT_SLEEP_US 50000 // test suite 12
+#define EVENT_RING_LEN 8 // test suite 13
+#define EVENT_NUM_RINGS 2 // test suite 13
+#define ARENA_NUM_RINGS 10000 // test suite 14
+#define ARENA_RING_LEN 16 // test suite 14
+#define RESIZE_RING_LEN 8 // test suite 15
+#define RESIZE_MAX_LEN 64 // test suite 15
+#define SHM_RING_LEN 256 // test suite 16
+#define SHM_NUM_BYTES (1 << 20) // test suite 16
+#define SHM_CHUNK 100 // test suite 16
+#define FILE_RING_LEN 64 // test suite 17
+#define MSG_RING_LEN 32 // test suite 18
+#define MSG_STREAM_RING_LEN 256 // test suite 18
+#define MSG_NUM_MSGS (1 << 16) // test suite 18
+#define MSG_MAX_LEN 40 // test suite 18
+#define BCAST_RING_LEN 16 // test suite 19
+#define BCAST_NUM_READERS 3 // test suite 19
+#define BCAST_NUM_BYTES (1 << 18) // test suite 19
+#define STATS_RING_LEN 8 // test suite 20
+#define STATS_NUM_BYTES (1 << 16) // test suite 20
+#define LAT_RING_LEN 16 // test suite 21
+#define LAT_SLEEP_US 2000 // test suite 21
+#define LAT_GROW_MAX_LEN 64 // test suite 21
+#define LAT_GROW_INSERTS 40 // test suite 21
+#define FIND_RING_LEN (1 << 16) // test suite 22
+#define FIND_SPAN 200 // test suite 22
+#define FRAME_RING_LEN 32 // test suite 23
+#define FRAME_MAX_LEN 16 // test suite 23
+#define FRAME_STREAM_RING_LEN 64 // test suite 23
+#define FRAME_STREAM_LINES (1 << 12) // test suite 23
+#define HIST_RING_LEN 4096 // test suite 24
 
 // Global variables.
 ring_t *ring; // test suite 1
@@ -187,6 +258,2068 @@ void testMULTIPLE_BUFFS_REMOVE(void)
     CU_ASSERT(0 == entries(rings[1]));
 }
 
+// TEST SUITE 3
+ring_t *spsc_ring;
+
+// Return 0 on success, non-zero otherwise.
+int init_suite_3()
+{
+    spsc_ring = init(SPSC_RING_LEN);
+    return 0;
+}
+
+// Return 0 on success, non-zero otherwise.
+int clean_suite_3()
+{
+    clean(spsc_ring);
+    return 0;
+}
+
+// Producer thread: push a known byte sequence, yielding while full so the test
+// also makes progress on a single core.
+void *spsc_producer(void *arg)
+{
+    ring_t *ring = arg;
+    for (int i = 0; i < SPSC_NUM_BYTES; i++)
+    {
+        while (!ring_insert(ring, (char)i)) { sched_yield(); }
+    }
+    return NULL;
+}
+
+/* Stream bytes from a producer thread to the test thread through a small ring
+   and check every byte arrives once, in order. Run under ThreadSanitizer with
+   `make unit_test_tsan` to check for data races. */
+void testSPSC_ACROSS_THREADS(void)
+{
+    pthread_t producer;
+    CU_ASSERT(0 == pthread_create(&producer, NULL, spsc_producer, spsc_ring));
+
+    int mismatches = 0;
+    for (int i = 0; i < SPSC_NUM_BYTES; i++)
+    {
+        char c;
+        while (!ring_remove(spsc_ring, &c)) { sched_yield(); }
+        if (c != (char)i) { mismatches++; }
+    }
+
+    CU_ASSERT(0 == pthread_join(producer, NULL));
+    CU_ASSERT(0 == mismatches);
+    CU_ASSERT(0 == entries(spsc_ring));
+}
+
+// TEST SUITE 4
+ring_t *bulk_ring;
+
+// Return 0 on success, non-zero otherwise.
+int init_suite_4()
+{
+    bulk_ring = init(BULK_RING_LEN);
+    return 0;
+}
+
+// Return 0 on success, non-zero otherwise.
+int clean_suite_4()
+{
+    clean(bulk_ring);
+    return 0;
+}
+
+/* Insert more bytes than fit and check only the free space is used, then
+   remove more bytes than are held and check only the held bytes come out. */
+void testBULK_PARTIAL(void)
+{
+    char out[16];
+    CU_ASSERT(5 == insert_n(bulk_ring, "ABCDE", 5));
+    CU_ASSERT(3 == insert_n(bulk_ring, "FGHIJ", 5));
+    CU_ASSERT(0 == insert_n(bulk_ring, "K", 1));
+    CU_ASSERT(8 == entries(bulk_ring));
+    CU_ASSERT(8 == remove_n(bulk_ring, out, sizeof(out)));
+    CU_ASSERT(0 == memcmp(out, "ABCDEFGH", 8));
+    CU_ASSERT(0 == remove_n(bulk_ring, out, sizeof(out)));
+}
+
+/* Move the indices to the middle of the buffer so bulk copies split across
+   the wrap point, and check the bytes still come out in FIFO order. */
+void testBULK_WRAP(void)
+{
+    char out[16];
+    CU_ASSERT(6 == insert_n(bulk_ring, "012345", 6));
+    CU_ASSERT(6 == remove_n(bulk_ring, out, 6));
+    CU_ASSERT(7 == insert_n(bulk_ring, "abcdefg", 7));
+    CU_ASSERT(3 == remove_n(bulk_ring, out, 3));
+    CU_ASSERT(0 == memcmp(out, "abc", 3));
+    CU_ASSERT(1 == insert(bulk_ring, 'h'));
+    CU_ASSERT(5 == remove_n(bulk_ring, out, 5));
+    CU_ASSERT(0 == memcmp(out, "defgh", 5));
+    CU_ASSERT(0 == entries(bulk_ring));
+}
+
+/* Reserve spans near the end of the buffer and check they stop at the wrap
+   point, that nothing is visible before commit, and that committed bytes come
+   out in order. Must be run after testBULK_WRAP. */
+void testRESERVE_COMMIT(void)
+{
+    char out[16];
+    char *p;
+
+    // Move the indices from slot 6 to slot 5.
+    CU_ASSERT(7 == insert_n(bulk_ring, "0123456", 7));
+    CU_ASSERT(7 == remove_n(bulk_ring, out, 7));
+
+    // Ini is at slot 5, so only 3 bytes are contiguous.
+    CU_ASSERT(3 == ring_reserve(bulk_ring, 8, &p));
+    memcpy(p, "abc", 3);
+    CU_ASSERT(0 == entries(bulk_ring));
+    ring_commit(bulk_ring, 3);
+    CU_ASSERT(3 == entries(bulk_ring));
+
+    // After the wrap the span is limited by the free space.
+    CU_ASSERT(5 == ring_reserve(bulk_ring, 8, &p));
+    CU_ASSERT(2 == ring_reserve(bulk_ring, 2, &p));
+    memcpy(p, "de", 2);
+    ring_commit(bulk_ring, 2);
+
+    CU_ASSERT(5 == remove_n(bulk_ring, out, sizeof(out)));
+    CU_ASSERT(0 == memcmp(out, "abcde", 5));
+}
+
+/* Peek at bytes that straddle the wrap point and check the first span stops at
+   the end of the buffer, the second picks up at the start, and consumed bytes
+   are released to the producer. Must be run after testRESERVE_COMMIT. */
+void testPEEK_CONSUME(void)
+{
+    char *p;
+
+    // Indices are at slot 2; fill to slot 1 so the data wraps.
+    CU_ASSERT(7 == insert_n(bulk_ring, "ABCDEFG", 7));
+    CU_ASSERT(6 == ring_peek(bulk_ring, &p));
+    CU_ASSERT(0 == memcmp(p, "ABCDEF", 6));
+
+    // Consume part of the span, then the rest.
+    ring_consume(bulk_ring, 2);
+    CU_ASSERT(5 == entries(bulk_ring));
+    CU_ASSERT(4 == ring_peek(bulk_ring, &p));
+    CU_ASSERT(0 == memcmp(p, "CDEF", 4));
+    ring_consume(bulk_ring, 4);
+
+    // The byte after the wrap point.
+    CU_ASSERT(1 == ring_peek(bulk_ring, &p));
+    CU_ASSERT('G' == *p);
+    ring_consume(bulk_ring, 1);
+    CU_ASSERT(0 == ring_peek(bulk_ring, &p));
+    CU_ASSERT(0 == entries(bulk_ring));
+}
+
+// TEST SUITE 5
+RING_DEFINE(static_test, STATIC_RING_LEN)
+
+/* Fill a RING_DEFINE() ring through its fixed-length helpers, drain it through
+   the generic functions, and check clean() only empties it. */
+void testSTATIC_RING(void)
+{
+    char c;
+    ring_t *ring = &static_test_ring;
+    CU_ASSERT(STATIC_RING_LEN == ring->Length);
+    CU_ASSERT(1 == static_test_insert('A'));
+    CU_ASSERT(1 == static_test_insert('B'));
+    CU_ASSERT(1 == insert(ring, 'C'));
+    CU_ASSERT(1 == static_test_insert('D'));
+    CU_ASSERT(0 == static_test_insert('E'));
+    CU_ASSERT(4 == entries(ring));
+    CU_ASSERT(1 == my_remove(ring, &c));
+    CU_ASSERT(1 == (c == 'A'))
+    CU_ASSERT(1 == static_test_remove(&c));
+    CU_ASSERT(1 == (c == 'B'))
+    clean(ring);
+    CU_ASSERT(0 == entries(ring));
+    CU_ASSERT(ring->Buffer != NULL);
+    CU_ASSERT(0 == static_test_remove(&c));
+}
+
+// TEST SUITE 6
+
+/* Record trace events directly and check the snapshot returns the newest
+   records, oldest first, and only the newest RING_TRACE_LEN of them. */
+void testTRACE_RECORDS(void)
+{
+    ring_trace_rec_t recs[RING_TRACE_LEN];
+    for (int i = 0; i < RING_TRACE_LEN + 3; i++)
+    {
+        ring_trace(RING_EV_INSERT, i, (char)i);
+    }
+    ring_trace(RING_EV_FULL, 7, 'Z');
+
+    CU_ASSERT(2 == ring_trace_snapshot(recs, 2));
+    CU_ASSERT(RING_EV_INSERT == recs[0].Event);
+    CU_ASSERT(RING_TRACE_LEN + 2 == recs[0].Index);
+    CU_ASSERT(RING_EV_FULL == recs[1].Event);
+    CU_ASSERT(7 == recs[1].Index);
+    CU_ASSERT('Z' == recs[1].Data);
+    CU_ASSERT(RING_TRACE_LEN == ring_trace_snapshot(recs, RING_TRACE_LEN));
+}
+
+// TEST SUITE 7
+mpmc_ring_t *mpmc_ring;
+atomic_int mpmc_counts[MPMC_NUM_THREADS];
+
+// Return 0 on success, non-zero otherwise.
+int init_suite_7()
+{
+    mpmc_ring = mpmc_init(MPMC_RING_LEN);
+    return 0;
+}
+
+// Return 0 on success, non-zero otherwise.
+int clean_suite_7()
+{
+    mpmc_clean(mpmc_ring);
+    return 0;
+}
+
+/* Fill and drain the ring from one thread and check FIFO order and the
+   full/empty results. */
+void testMPMC_SINGLE_THREAD(void)
+{
+    char c;
+    for (int i = 0; i < MPMC_RING_LEN; i++)
+    {
+        CU_ASSERT(1 == mpmc_insert(mpmc_ring, 'a' + i));
+    }
+    CU_ASSERT(0 == mpmc_insert(mpmc_ring, 'z'));
+    CU_ASSERT(MPMC_RING_LEN == mpmc_entries(mpmc_ring));
+    for (int i = 0; i < MPMC_RING_LEN; i++)
+    {
+        CU_ASSERT(1 == mpmc_remove(mpmc_ring, &c));
+        CU_ASSERT(1 == (c == 'a' + i))
+    }
+    CU_ASSERT(0 == mpmc_remove(mpmc_ring, &c));
+}
+
+// Producer thread: push MPMC_NUM_BYTES copies of its own id.
+void *mpmc_producer(void *arg)
+{
+    char id = (char)(long)arg;
+    for (int i = 0; i < MPMC_NUM_BYTES; i++)
+    {
+        while (!mpmc_insert(mpmc_ring, id)) { sched_yield(); }
+    }
+    return NULL;
+}
+
+// Consumer thread: pop MPMC_NUM_BYTES bytes and count them by producer id.
+void *mpmc_consumer(void *arg)
+{
+    for (int i = 0; i < MPMC_NUM_BYTES; i++)
+    {
+        char id;
+        while (!mpmc_remove(mpmc_ring, &id)) { sched_yield(); }
+        if (id >= 0 && id < MPMC_NUM_THREADS)
+        {
+            atomic_fetch_add(&mpmc_counts[(int)id], 1);
+        }
+    }
+    return NULL;
+}
+
+/* Run several producers and consumers at once and check every byte is
+   delivered exactly once. */
+void testMPMC_ACROSS_THREADS(void)
+{
+    pthread_t producers[MPMC_NUM_THREADS];
+    pthread_t consumers[MPMC_NUM_THREADS];
+    for (long i = 0; i < MPMC_NUM_THREADS; i++)
+    {
+        CU_ASSERT(0 == pthread_create(&producers[i], NULL, mpmc_producer, \
+                                      (void *)i));
+        CU_ASSERT(0 == pthread_create(&consumers[i], NULL, mpmc_consumer, \
+                                      NULL));
+    }
+    for (int i = 0; i < MPMC_NUM_THREADS; i++)
+    {
+        CU_ASSERT(0 == pthread_join(producers[i], NULL));
+        CU_ASSERT(0 == pthread_join(consumers[i], NULL));
+    }
+    for (int i = 0; i < MPMC_NUM_THREADS; i++)
+    {
+        CU_ASSERT(MPMC_NUM_BYTES == atomic_load(&mpmc_counts[i]));
+    }
+    CU_ASSERT(0 == mpmc_entries(mpmc_ring));
+}
+
+// TEST SUITE 8
+ring_t *mirror_ring;
+
+// Return 0 on success, non-zero otherwise.
+int init_suite_8()
+{
+    mirror_ring = init_mirrored(MIRROR_RING_LEN);
+    return (mirror_ring == NULL);
+}
+
+// Return 0 on success, non-zero otherwise.
+int clean_suite_8()
+{
+    clean_mirrored(mirror_ring);
+    return 0;
+}
+
+/* Check that the second mapping aliases the first and that data straddling
+   the end of the buffer is readable and writable as a single span. */
+void testMIRROR_CONTIGUOUS(void)
+{
+    char *p;
+    char out[8];
+    mirror_ring->Buffer[3] = 'x';
+    CU_ASSERT('x' == mirror_ring->Buffer[MIRROR_RING_LEN + 3]);
+
+    // Move the indices to 4 bytes before the end.
+    CU_ASSERT(MIRROR_RING_LEN - 4 == \
+              ring_reserve(mirror_ring, MIRROR_RING_LEN - 4, &p));
+    ring_commit(mirror_ring, MIRROR_RING_LEN - 4);
+    CU_ASSERT(MIRROR_RING_LEN - 4 == ring_peek(mirror_ring, &p));
+    ring_consume(mirror_ring, MIRROR_RING_LEN - 4);
+
+    // A reserve and a peek across the end are each one span.
+    CU_ASSERT(8 == ring_reserve(mirror_ring, 8, &p));
+    memcpy(p, "01234567", 8);
+    ring_commit(mirror_ring, 8);
+    CU_ASSERT(8 == ring_peek(mirror_ring, &p));
+    CU_ASSERT(0 == memcmp(p, "01234567", 8));
+    CU_ASSERT(0 == memcmp(mirror_ring->Buffer, "4567", 4));
+    CU_ASSERT(8 == remove_n(mirror_ring, out, sizeof(out)));
+    CU_ASSERT(0 == memcmp(out, "01234567", 8));
+}
+
+// TEST SUITE 9
+// A 12-byte element, so element size is not a power of 2.
+typedef struct
+{
+    unsigned int Ticks;
+    short Id;
+    char Tag[6];
+} event_t;
+
+RING_TYPED(event_ring, event_t)
+
+/* Queue whole structs, including across the wrap point, and check they come
+   back intact and in order. */
+void testTYPED_RING(void)
+{
+    event_ring_t *ring = event_ring_init(TYPED_RING_LEN);
+    event_t in[6] = { {1, 10, "a"}, {2, 20, "bb"}, {3, 30, "ccc"},
+                      {4, 40, "dddd"}, {5, 50, "eeeee"}, {6, 60, "f"} };
+    event_t out[6];
+
+    CU_ASSERT(1 == event_ring_insert(ring, &in[0]));
+    CU_ASSERT(1 == event_ring_insert(ring, &in[1]));
+    CU_ASSERT(1 == event_ring_insert(ring, &in[2]));
+    CU_ASSERT(1 == event_ring_remove(ring, &out[0]));
+    CU_ASSERT(0 == memcmp(&out[0], &in[0], sizeof(event_t)));
+
+    // Two more fit, wrapping past the end; a third does not.
+    CU_ASSERT(2 == event_ring_insert_n(ring, &in[3], 2));
+    CU_ASSERT(0 == event_ring_insert(ring, &in[5]));
+    CU_ASSERT(4 == event_ring_entries(ring));
+    CU_ASSERT(4 == event_ring_remove_n(ring, out, 6));
+    CU_ASSERT(0 == memcmp(out, &in[1], 4 * sizeof(event_t)));
+    CU_ASSERT(0 == event_ring_remove(ring, &out[0]));
+
+    event_ring_clean(ring);
+}
+
+// TEST SUITE 10
+ring_t *overwrite_ring;
+
+// Return 0 on success, non-zero otherwise.
+int init_suite_10()
+{
+    overwrite_ring = init(OVERWRITE_RING_LEN);
+    ring_set_overwrite(overwrite_ring, 1);
+    return 0;
+}
+
+// Return 0 on success, non-zero otherwise.
+int clean_suite_10()
+{
+    clean(overwrite_ring);
+    return 0;
+}
+
+/* Insert more chars than fit and check insert() never fails, the newest chars
+   are kept and the dropped ones are counted. */
+void testOVERWRITE_INSERT(void)
+{
+    char c;
+    CU_ASSERT(1 == insert(overwrite_ring, 'A'));
+    CU_ASSERT(1 == insert(overwrite_ring, 'B'));
+    CU_ASSERT(1 == insert(overwrite_ring, 'C'));
+    CU_ASSERT(1 == insert(overwrite_ring, 'D'));
+    CU_ASSERT(1 == insert(overwrite_ring, 'E'));
+    CU_ASSERT(1 == insert(overwrite_ring, 'F'));
+    CU_ASSERT(4 == entries(overwrite_ring));
+    CU_ASSERT(2 == ring_overwritten(overwrite_ring));
+    CU_ASSERT(1 == my_remove(overwrite_ring, &c));
+    CU_ASSERT(1 == (c == 'C'))
+    CU_ASSERT(1 == my_remove(overwrite_ring, &c));
+    CU_ASSERT(1 == (c == 'D'))
+}
+
+/* Bulk insert into a partly full ring and a burst longer than the ring, and
+   check only the newest bytes survive. Must be run after
+   testOVERWRITE_INSERT. */
+void testOVERWRITE_INSERT_N(void)
+{
+    char out[8];
+    CU_ASSERT(3 == insert_n(overwrite_ring, "xyz", 3));
+    CU_ASSERT(3 == ring_overwritten(overwrite_ring));
+    CU_ASSERT(4 == remove_n(overwrite_ring, out, sizeof(out)));
+    CU_ASSERT(0 == memcmp(out, "Fxyz", 4));
+
+    CU_ASSERT(4 == insert_n(overwrite_ring, "0123456789", 10));
+    CU_ASSERT(9 == ring_overwritten(overwrite_ring));
+    CU_ASSERT(4 == remove_n(overwrite_ring, out, sizeof(out)));
+    CU_ASSERT(0 == memcmp(out, "6789", 4));
+    CU_ASSERT(0 == entries(overwrite_ring));
+}
+
+atomic_int overwrite_done;
+
+// Producer thread: stream a known byte sequence in varying chunk sizes, never
+// waiting for the consumer.
+void *overwrite_producer(void *arg)
+{
+    ring_t *ring = arg;
+    char chunk[OVERWRITE_THREAD_RING_LEN + 4];
+    int sent = 0;
+    while (sent < OVERWRITE_NUM_BYTES)
+    {
+        int len = sent % (int)sizeof(chunk);
+        if (len == 0)
+        {
+            ring_insert(ring, (char)sent);
+            sent++;
+            continue;
+        }
+        if (len > OVERWRITE_NUM_BYTES - sent)
+        {
+            len = OVERWRITE_NUM_BYTES - sent;
+        }
+        for (int i = 0; i < len; i++) { chunk[i] = (char)(sent + i); }
+        insert_n(ring, chunk, len);
+        sent += len;
+    }
+    atomic_store(&overwrite_done, 1);
+    return NULL;
+}
+
+/* Overwrite a small ring from a producer thread while the test thread drains
+   it, and check every bulk remove returns consecutive bytes and every byte is
+   either received or counted as overwritten. Run under ThreadSanitizer with
+   `make unit_test_tsan` to check for data races. */
+void testOVERWRITE_ACROSS_THREADS(void)
+{
+    ring_t *ring = init(OVERWRITE_THREAD_RING_LEN);
+    ring_set_overwrite(ring, 1);
+    atomic_store(&overwrite_done, 0);
+
+    pthread_t producer;
+    CU_ASSERT(0 == pthread_create(&producer, NULL, overwrite_producer, ring));
+
+    char out[OVERWRITE_THREAD_RING_LEN];
+    size_t received = 0;
+    int mismatches = 0;
+    for (;;)
+    {
+        int done = atomic_load(&overwrite_done);
+        size_t n = remove_n(ring, out, (received % sizeof(out)) + 1);
+        for (size_t i = 1; i < n; i++)
+        {
+            if (out[i] != (char)(out[i - 1] + 1)) { mismatches++; }
+        }
+        received += n;
+
+        char c;
+        received += ring_remove(ring, &c);
+        if (done && entries(ring) == 0) { break; }
+        if (n == 0) { sched_yield(); }
+    }
+
+    CU_ASSERT(0 == pthread_join(producer, NULL));
+    CU_ASSERT(0 == mismatches);
+    CU_ASSERT(OVERWRITE_NUM_BYTES == received + ring_overwritten(ring));
+    clean(ring);
+}
+
+// TEST SUITE 11
+ring_t *wrap_ring;
+
+// Return 0 on success, non-zero otherwise.
+int init_suite_11()
+{
+    wrap_ring = init(WRAP_RING_LEN);
+    return 0;
+}
+
+// Return 0 on success, non-zero otherwise.
+int clean_suite_11()
+{
+    clean(wrap_ring);
+    return 0;
+}
+
+// Move the indices of an empty ring to the given value.
+void set_indices(ring_t *ring, size_t index)
+{
+    atomic_store(&ring->Ini, index);
+    atomic_store(&ring->Outi, index);
+    ring->Outi_Cache = index;
+    ring->Ini_Cache = index;
+}
+
+/* Fill and drain the ring while Ini and then Outi wrap past SIZE_MAX, and
+   check the full/empty checks and entries() stay correct. */
+void testWRAP_FULL_EMPTY(void)
+{
+    char c;
+    char out[WRAP_RING_LEN];
+    set_indices(wrap_ring, SIZE_MAX - 1);
+    for (int i = 0; i < WRAP_RING_LEN; i++)
+    {
+        CU_ASSERT(1 == insert(wrap_ring, (char)i));
+    }
+    CU_ASSERT(0 == insert(wrap_ring, 'X'));
+    CU_ASSERT(WRAP_RING_LEN == entries(wrap_ring));
+    CU_ASSERT(1 == my_remove(wrap_ring, &c));
+    CU_ASSERT(1 == (c == 0));
+    CU_ASSERT(WRAP_RING_LEN - 1 == entries(wrap_ring));
+    CU_ASSERT(WRAP_RING_LEN - 1 == remove_n(wrap_ring, out, WRAP_RING_LEN));
+    for (int i = 1; i < WRAP_RING_LEN; i++)
+    {
+        CU_ASSERT(out[i - 1] == (char)i);
+    }
+    CU_ASSERT(0 == my_remove(wrap_ring, &c));
+    CU_ASSERT(0 == entries(wrap_ring));
+}
+
+// Producer thread: stream a known byte sequence in varying chunk sizes.
+void *wrap_producer(void *arg)
+{
+    char chunk[WRAP_RING_LEN];
+    int sent = 0;
+    while (sent < WRAP_NUM_BYTES)
+    {
+        int len = 1 + (sent % (WRAP_RING_LEN - 1));
+        if (len > WRAP_NUM_BYTES - sent) { len = WRAP_NUM_BYTES - sent; }
+        for (int i = 0; i < len; i++) { chunk[i] = (char)(sent + i); }
+
+        int done = 0;
+        while (done < len)
+        {
+            size_t n = insert_n(wrap_ring, chunk + done, len - done);
+            if (n == 0) { sched_yield(); }
+            done += n;
+        }
+        sent += len;
+    }
+    return NULL;
+}
+
+/* Long soak: start the indices just below SIZE_MAX and stream bytes between
+   two threads with bulk inserts and zero-copy reads, so the indices cross the
+   wrap point with the ring in every fill state. Check every byte. */
+void testWRAP_SOAK(void)
+{
+    set_indices(wrap_ring, SIZE_MAX - WRAP_NUM_BYTES / 2);
+
+    pthread_t producer;
+    CU_ASSERT(0 == pthread_create(&producer, NULL, wrap_producer, NULL));
+
+    int received = 0;
+    int mismatches = 0;
+    while (received < WRAP_NUM_BYTES)
+    {
+        char *p;
+        size_t span = ring_peek(wrap_ring, &p);
+        if (span == 0) { sched_yield(); continue; }
+        for (size_t i = 0; i < span; i++)
+        {
+            if (p[i] != (char)(received + i)) { mismatches++; }
+        }
+        ring_consume(wrap_ring, span);
+        received += span;
+    }
+
+    CU_ASSERT(0 == pthread_join(producer, NULL));
+    CU_ASSERT(0 == mismatches);
+    CU_ASSERT(WRAP_NUM_BYTES == received);
+    CU_ASSERT(0 == entries(wrap_ring));
+    CU_ASSERT(atomic_load(&wrap_ring->Ini) < SIZE_MAX / 2); // it did wrap
+}
+
+// TEST SUITE 12
+ring_t *wait_ring;
+atomic_int wait_done;
+
+// Return 0 on success, non-zero otherwise. A spin budget of 0 makes every
+// wait go to sleep on the futex.
+int init_suite_12()
+{
+    wait_ring = init(WAIT_RING_LEN);
+    return !ring_wait_attach(wait_ring, 0);
+}
+
+// Return 0 on success, non-zero otherwise.
+int clean_suite_12()
+{
+    ring_wait_detach(wait_ring);
+    clean(wait_ring);
+    return 0;
+}
+
+// Consumer thread: block for one char, then flag that it got it.
+void *wait_consumer(void *arg)
+{
+    char *c = arg;
+    ring_remove_wait(wait_ring, c);
+    atomic_store(&wait_done, 1);
+    return NULL;
+}
+
+/* Block a consumer on an empty ring and check it stays asleep until a char is
+   inserted, then wakes up with that char. */
+void testWAIT_SLEEP_AND_WAKE(void)
+{
+    pthread_t consumer;
+    char c = 0;
+    atomic_store(&wait_done, 0);
+    CU_ASSERT(0 == pthread_create(&consumer, NULL, wait_consumer, &c));
+
+    usleep(WAIT_SLEEP_US);
+    CU_ASSERT(0 == atomic_load(&wait_done));
+    CU_ASSERT(1 == insert(wait_ring, 'W'));
+
+    CU_ASSERT(0 == pthread_join(consumer, NULL));
+    CU_ASSERT(1 == atomic_load(&wait_done));
+    CU_ASSERT('W' == c);
+}
+
+// Producer thread: stream a known byte sequence, blocking while full.
+void *wait_producer(void *arg)
+{
+    for (int i = 0; i < WAIT_NUM_BYTES; i++)
+    {
+        ring_insert_wait(wait_ring, (char)i);
+    }
+    return NULL;
+}
+
+/* Stream bytes through a small ring with both sides blocking, so each side
+   repeatedly sleeps and is woken by the other, and check every byte. */
+void testWAIT_BLOCKING_STREAM(void)
+{
+    pthread_t producer;
+    CU_ASSERT(0 == pthread_create(&producer, NULL, wait_producer, NULL));
+
+    int mismatches = 0;
+    for (int i = 0; i < WAIT_NUM_BYTES; i++)
+    {
+        char c;
+        ring_remove_wait(wait_ring, &c);
+        if (c != (char)i) { mismatches++; }
+    }
+
+    CU_ASSERT(0 == pthread_join(producer, NULL));
+    CU_ASSERT(0 == mismatches);
+    CU_ASSERT(0 == entries(wait_ring));
+}
+
+// TEST SUITE 13
+ring_t *event_rings[EVENT_NUM_RINGS];
+int event_epfd;
+
+// Return 0 on success, non-zero otherwise. Register every ring's readable fd
+// with one epoll set, tagged with the ring.
+int init_suite_13()
+{
+    event_epfd = epoll_create1(0);
+    if (event_epfd < 0) { return 1; }
+    for (int i = 0; i < EVENT_NUM_RINGS; i++)
+    {
+        event_rings[i] = init(EVENT_RING_LEN);
+        if (!ring_event_attach(event_rings[i])) { return 1; }
+
+        struct epoll_event ev = {.events = EPOLLIN, .data.ptr = event_rings[i]};
+        if (epoll_ctl(event_epfd, EPOLL_CTL_ADD,
+                      ring_event_readable_fd(event_rings[i]), &ev))
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// Return 0 on success, non-zero otherwise.
+int clean_suite_13()
+{
+    for (int i = 0; i < EVENT_NUM_RINGS; i++)
+    {
+        ring_event_detach(event_rings[i]);
+        clean(event_rings[i]);
+    }
+    close(event_epfd);
+    return 0;
+}
+
+// Producer thread: insert a burst into the ring passed in.
+void *event_producer(void *arg)
+{
+    insert_n(arg, "abc", 3);
+    return NULL;
+}
+
+/* Wait in epoll while another thread writes a burst into one ring. Check only
+   that ring is reported, the burst was signaled once, and after draining and
+   rearming nothing is pending. */
+void testEVENT_EPOLL_READABLE(void)
+{
+    struct epoll_event ev;
+    pthread_t producer;
+    CU_ASSERT(0 == epoll_wait(event_epfd, &ev, 1, 0));
+    CU_ASSERT(0 == pthread_create(&producer, NULL, event_producer,
+                                  event_rings[1]));
+    CU_ASSERT(1 == epoll_wait(event_epfd, &ev, 1, -1));
+    CU_ASSERT(0 == pthread_join(producer, NULL));
+    CU_ASSERT(event_rings[1] == ev.data.ptr);
+
+    // Three inserts, one signal.
+    uint64_t count = 0;
+    CU_ASSERT(sizeof(count) ==
+              read(ring_event_readable_fd(event_rings[1]), &count,
+                   sizeof(count)));
+    CU_ASSERT(1 == count);
+
+    char buf[EVENT_RING_LEN];
+    CU_ASSERT(3 == remove_n(event_rings[1], buf, sizeof(buf)));
+    CU_ASSERT(0 == memcmp(buf, "abc", 3));
+    CU_ASSERT(0 == ring_event_rearm_readable(event_rings[1]));
+    CU_ASSERT(0 == epoll_wait(event_epfd, &ev, 1, 0));
+}
+
+/* Rearming while data is still in the ring must report it, so the caller
+   keeps draining instead of waiting for a signal that already happened. The
+   ring was never full, so the remove must not signal the writable fd. */
+void testEVENT_REARM_RECHECK(void)
+{
+    struct epoll_event ev;
+    ring_t *ring = event_rings[0];
+    struct pollfd pfd = {.fd = ring_event_writable_fd(ring), .events = POLLIN};
+    CU_ASSERT(1 == insert(ring, 'x'));
+    CU_ASSERT(1 == ring_event_rearm_readable(ring));
+
+    char c;
+    CU_ASSERT(1 == my_remove(ring, &c));
+    CU_ASSERT(0 == ring_event_rearm_readable(ring));
+    CU_ASSERT(0 == epoll_wait(event_epfd, &ev, 1, 0));
+    CU_ASSERT(0 == poll(&pfd, 1, 0));
+}
+
+/* Fill a ring, arm its writable fd, and check that removing a byte signals
+   the full to non-full transition. */
+void testEVENT_WRITABLE(void)
+{
+    ring_t *ring = event_rings[0];
+    char buf[EVENT_RING_LEN] = {0};
+    int wfd = ring_event_writable_fd(ring);
+    struct pollfd pfd = {.fd = wfd, .events = POLLIN};
+
+    CU_ASSERT(EVENT_RING_LEN == insert_n(ring, buf, sizeof(buf)));
+    CU_ASSERT(0 == ring_event_rearm_writable(ring));
+    CU_ASSERT(0 == poll(&pfd, 1, 0));
+
+    char c;
+    CU_ASSERT(1 == my_remove(ring, &c));
+    CU_ASSERT(1 == poll(&pfd, 1, 0));
+    CU_ASSERT(1 == ring_event_rearm_writable(ring));
+
+    CU_ASSERT(EVENT_RING_LEN - 1 == remove_n(ring, buf, sizeof(buf)));
+    CU_ASSERT(0 == ring_event_rearm_readable(ring));
+}
+
+// TEST SUITE 14
+ring_arena_t *arena;
+
+// Return 0 on success, non-zero otherwise.
+int init_suite_14()
+{
+    arena = ring_arena_create(ARENA_NUM_RINGS,
+                              ARENA_NUM_RINGS * RING_CACHE_LINE);
+    return arena == NULL;
+}
+
+// Return 0 on success, non-zero otherwise.
+int clean_suite_14()
+{
+    ring_arena_free(arena);
+    return 0;
+}
+
+/* Fill the arena with rings. Check the headers are consecutive, every buffer
+   is cache-line aligned and on its own line, and the next alloc fails. */
+void testARENA_ALLOC(void)
+{
+    int bad = 0;
+    for (size_t i = 0; i < ARENA_NUM_RINGS; i++)
+    {
+        ring_t *ring = ring_arena_alloc(arena, ARENA_RING_LEN);
+        if (ring != &arena->Rings[i] ||
+            ((uintptr_t)ring->Buffer % RING_CACHE_LINE) != 0 ||
+            (i > 0 && ring->Buffer !=
+                      arena->Rings[i - 1].Buffer + RING_CACHE_LINE))
+        {
+            bad++;
+        }
+    }
+    CU_ASSERT(0 == bad);
+    CU_ASSERT(ARENA_NUM_RINGS == arena->Num_Rings);
+    CU_ASSERT(NULL == ring_arena_alloc(arena, ARENA_RING_LEN));
+}
+
+/* Arena rings behave like any other ring, stay independent of their
+   neighbours, and clean() only empties them. */
+void testARENA_RINGS(void)
+{
+    ring_t *a = &arena->Rings[0];
+    ring_t *b = &arena->Rings[1];
+    char buf[ARENA_RING_LEN];
+
+    CU_ASSERT(ARENA_RING_LEN ==
+              insert_n(a, "0123456789abcdef", ARENA_RING_LEN));
+    CU_ASSERT(0 == insert(a, 'x'));
+    CU_ASSERT(1 == insert(b, 'y'));
+    CU_ASSERT(ARENA_RING_LEN == remove_n(a, buf, sizeof(buf)));
+    CU_ASSERT(0 == memcmp(buf, "0123456789abcdef", ARENA_RING_LEN));
+    CU_ASSERT(1 == entries(b));
+
+    clean(b);
+    CU_ASSERT(0 == entries(b));
+    CU_ASSERT(NULL != b->Buffer);
+}
+
+// TEST SUITE 15
+ring_t *resize_ring;
+
+// Return 0 on success, non-zero otherwise.
+int init_suite_15()
+{
+    resize_ring = init(RESIZE_RING_LEN);
+    return 0;
+}
+
+// Return 0 on success, non-zero otherwise.
+int clean_suite_15()
+{
+    clean(resize_ring);
+    return 0;
+}
+
+/* Resize a ring whose live bytes wrap around the end of the buffer, both up
+   and back down, and check the bytes come out in order. A resize smaller than
+   the live bytes must fail and leave the ring alone. */
+void testRESIZE_WRAPPED(void)
+{
+    char buf[RESIZE_RING_LEN];
+    CU_ASSERT(6 == insert_n(resize_ring, "xxxxxx", 6));
+    CU_ASSERT(6 == remove_n(resize_ring, buf, 6));
+    CU_ASSERT(5 == insert_n(resize_ring, "abcde", 5)); // slots 6..10
+
+    CU_ASSERT(1 == ring_resize(resize_ring, 4 * RESIZE_RING_LEN));
+    CU_ASSERT(4 * RESIZE_RING_LEN == resize_ring->Length);
+    CU_ASSERT(5 == entries(resize_ring));
+    CU_ASSERT(2 == insert_n(resize_ring, "fg", 2));
+
+    CU_ASSERT(0 == ring_resize(resize_ring, 4));
+    CU_ASSERT(1 == ring_resize(resize_ring, RESIZE_RING_LEN));
+    CU_ASSERT(7 == remove_n(resize_ring, buf, sizeof(buf)));
+    CU_ASSERT(0 == memcmp(buf, "abcdefg", 7));
+}
+
+/* With auto-grow on, a burst larger than the ring doubles it up to the bound
+   without losing bytes, and draining shrinks it back to its first length. */
+void testRESIZE_AUTOGROW(void)
+{
+    char in[2 * RESIZE_MAX_LEN];
+    char out[2 * RESIZE_MAX_LEN];
+    for (int i = 0; i < (int)sizeof(in); i++) { in[i] = (char)i; }
+
+    ring_set_autogrow(resize_ring, RESIZE_MAX_LEN, 25);
+    CU_ASSERT(RESIZE_RING_LEN + 1 == insert_n(resize_ring, in,
+                                              RESIZE_RING_LEN + 1));
+    CU_ASSERT(2 * RESIZE_RING_LEN == resize_ring->Length);
+    int failed = 0;
+    for (int i = RESIZE_RING_LEN + 1; i < 2 * RESIZE_RING_LEN + 1; i++)
+    {
+        if (!insert(resize_ring, in[i])) { failed++; }
+    }
+    CU_ASSERT(0 == failed);
+    CU_ASSERT(4 * RESIZE_RING_LEN == resize_ring->Length);
+
+    // Capped at the bound.
+    size_t n = insert_n(resize_ring, in + 2 * RESIZE_RING_LEN + 1,
+                        sizeof(in) - 2 * RESIZE_RING_LEN - 1);
+    CU_ASSERT(RESIZE_MAX_LEN == resize_ring->Length);
+    CU_ASSERT(RESIZE_MAX_LEN == entries(resize_ring));
+    CU_ASSERT(RESIZE_MAX_LEN - 2 * RESIZE_RING_LEN - 1 == n);
+    CU_ASSERT(0 == insert(resize_ring, 'z'));
+
+    // Shrinks back as it drains.
+    CU_ASSERT(RESIZE_MAX_LEN - 4 == remove_n(resize_ring, out,
+                                             RESIZE_MAX_LEN - 4));
+    CU_ASSERT(RESIZE_RING_LEN == resize_ring->Length);
+    CU_ASSERT(4 == remove_n(resize_ring, out + RESIZE_MAX_LEN - 4, 4));
+    CU_ASSERT(0 == memcmp(in, out, RESIZE_MAX_LEN));
+    CU_ASSERT(RESIZE_RING_LEN == resize_ring->Length);
+    ring_set_autogrow(resize_ring, 0, 0);
+}
+
+/* With a shrink percentage of 0 the ring grows but never shrinks, not even
+   when it is drained empty. */
+void testRESIZE_NO_SHRINK(void)
+{
+    char buf[RESIZE_MAX_LEN] = {0};
+    ring_t *ring = init(RESIZE_RING_LEN);
+    ring_set_autogrow(ring, RESIZE_MAX_LEN, 0);
+
+    CU_ASSERT(RESIZE_MAX_LEN == insert_n(ring, buf, sizeof(buf)));
+    CU_ASSERT(RESIZE_MAX_LEN == ring->Length);
+    CU_ASSERT(RESIZE_MAX_LEN - 1 == remove_n(ring, buf, RESIZE_MAX_LEN - 1));
+    CU_ASSERT(1 == my_remove(ring, buf));
+    CU_ASSERT(0 == entries(ring));
+    CU_ASSERT(RESIZE_MAX_LEN == ring->Length);
+    clean(ring);
+}
+
+// TEST SUITE 16
+char shm_name[32];
+pi_ring_t *shm_ring;
+
+// Return 0 on success, non-zero otherwise.
+int init_suite_16()
+{
+    snprintf(shm_name, sizeof(shm_name), "/ring_test_%d", (int)getpid());
+    shm_ring = shm_ring_create(shm_name, SHM_RING_LEN);
+    return shm_ring == NULL;
+}
+
+// Return 0 on success, non-zero otherwise.
+int clean_suite_16()
+{
+    shm_ring_detach(shm_ring);
+    shm_ring_unlink(shm_name);
+    return 0;
+}
+
+/* The header has no pointers and round trips bytes across the wrap. A second
+   mapping of the same object, at another address, sees the same ring. */
+void testSHM_ATTACH(void)
+{
+    pi_ring_t *view = shm_ring_attach(shm_name);
+    CU_ASSERT(NULL != view);
+    if (view == NULL) { return; }
+    CU_ASSERT(view != shm_ring);
+    CU_ASSERT(SHM_RING_LEN == view->Length);
+
+    char buf[SHM_RING_LEN];
+    memset(buf, 'x', sizeof(buf));
+    CU_ASSERT(SHM_RING_LEN - 2 == pi_insert_n(shm_ring, buf, SHM_RING_LEN - 2));
+    CU_ASSERT(SHM_RING_LEN - 2 == pi_remove_n(view, buf, sizeof(buf)));
+    CU_ASSERT(5 == pi_insert_n(shm_ring, "hello", 5));
+    CU_ASSERT(5 == pi_entries(view));
+    CU_ASSERT(5 == pi_remove_n(view, buf, sizeof(buf)));
+    CU_ASSERT(0 == memcmp(buf, "hello", 5));
+    shm_ring_detach(view);
+
+    CU_ASSERT(NULL == shm_ring_attach("/ring_test_missing"));
+}
+
+/* Stream a known byte sequence from a child process, which attaches by name,
+   to this one through the shared ring, and check every byte. */
+void testSHM_CROSS_PROCESS(void)
+{
+    pid_t pid = fork();
+    CU_ASSERT(pid >= 0);
+    if (pid == 0)
+    {
+        pi_ring_t *ring = shm_ring_attach(shm_name);
+        if (ring == NULL) { _exit(1); }
+        char chunk[SHM_CHUNK];
+        for (int i = 0; i < SHM_NUM_BYTES; )
+        {
+            int n = 0;
+            for (; n < SHM_CHUNK && i + n < SHM_NUM_BYTES; n++)
+            {
+                chunk[n] = (char)(i + n);
+            }
+            for (int sent = 0; sent < n; )
+            {
+                size_t k = pi_insert_n(ring, chunk + sent, n - sent);
+                if (k == 0) { sched_yield(); }
+                sent += k;
+            }
+            i += n;
+        }
+        shm_ring_detach(ring);
+        _exit(0);
+    }
+
+    int mismatches = 0;
+    char buf[SHM_CHUNK];
+    for (int i = 0; i < SHM_NUM_BYTES; )
+    {
+        size_t k = pi_remove_n(shm_ring, buf, sizeof(buf));
+        if (k == 0) { sched_yield(); }
+        for (size_t j = 0; j < k; j++, i++)
+        {
+            if (buf[j] != (char)i) { mismatches++; }
+        }
+    }
+
+    int status;
+    CU_ASSERT(pid == waitpid(pid, &status, 0));
+    CU_ASSERT(WIFEXITED(status) && 0 == WEXITSTATUS(status));
+    CU_ASSERT(0 == mismatches);
+    CU_ASSERT(0 == pi_entries(shm_ring));
+}
+
+// TEST SUITE 17
+char file_path[64];
+
+// Return 0 on success, non-zero otherwise.
+int init_suite_17()
+{
+    snprintf(file_path, sizeof(file_path), "/tmp/ring_test_%d.ring",
+             (int)getpid());
+    unlink(file_path);
+    return 0;
+}
+
+// Return 0 on success, non-zero otherwise.
+int clean_suite_17()
+{
+    unlink(file_path);
+    return 0;
+}
+
+/* Close and reopen a file ring and check its contents and indices carry
+   over. Reopening with a different length must fail. */
+void testFILE_REOPEN(void)
+{
+    char buf[FILE_RING_LEN];
+    file_ring_t *file = file_ring_open(file_path, FILE_RING_LEN, 0);
+    CU_ASSERT(NULL != file);
+    if (file == NULL) { return; }
+    CU_ASSERT(6 == file_ring_insert_n(file, "abcdef", 6));
+    CU_ASSERT(2 == file_ring_remove_n(file, buf, 2));
+    file_ring_close(file);
+
+    CU_ASSERT(NULL == file_ring_open(file_path, 2 * FILE_RING_LEN, 0));
+    file = file_ring_open(file_path, FILE_RING_LEN, 0);
+    CU_ASSERT(NULL != file);
+    if (file == NULL) { return; }
+    CU_ASSERT(4 == pi_entries(file->Ring));
+    CU_ASSERT(4 == file_ring_remove_n(file, buf, sizeof(buf)));
+    CU_ASSERT(0 == memcmp(buf, "cdef", 4));
+    file_ring_close(file);
+}
+
+/* A child process inserts into the ring and dies without closing or syncing
+   it. The bytes must still be there when the ring is reopened. */
+void testFILE_CRASH(void)
+{
+    pid_t pid = fork();
+    CU_ASSERT(pid >= 0);
+    if (pid == 0)
+    {
+        file_ring_t *file = file_ring_open(file_path, FILE_RING_LEN, 0);
+        if (file == NULL) { _exit(1); }
+        file_ring_insert_n(file, "crash", 5);
+        kill(getpid(), SIGKILL);
+    }
+
+    int status;
+    CU_ASSERT(pid == waitpid(pid, &status, 0));
+    CU_ASSERT(WIFSIGNALED(status));
+
+    char buf[FILE_RING_LEN];
+    file_ring_t *file = file_ring_open(file_path, FILE_RING_LEN, 0);
+    CU_ASSERT(NULL != file);
+    if (file == NULL) { return; }
+    CU_ASSERT(5 == file_ring_remove_n(file, buf, sizeof(buf)));
+    CU_ASSERT(0 == memcmp(buf, "crash", 5));
+    file_ring_close(file);
+}
+
+/* A crash after sizing a new ring file but before formatting it leaves a
+   zero-filled file of the right size. Opening it must format it again. */
+void testFILE_UNFORMATTED(void)
+{
+    unlink(file_path);
+    FILE *f = fopen(file_path, "w");
+    CU_ASSERT(NULL != f);
+    if (f == NULL) { return; }
+    fclose(f);
+    CU_ASSERT(0 == truncate(file_path, PI_RING_SIZE(FILE_RING_LEN)));
+
+    char buf[FILE_RING_LEN];
+    file_ring_t *file = file_ring_open(file_path, FILE_RING_LEN, 0);
+    CU_ASSERT(NULL != file);
+    if (file == NULL) { return; }
+    CU_ASSERT(0 == pi_entries(file->Ring));
+    CU_ASSERT(3 == file_ring_insert_n(file, "new", 3));
+    CU_ASSERT(3 == file_ring_remove_n(file, buf, sizeof(buf)));
+    CU_ASSERT(0 == memcmp(buf, "new", 3));
+    file_ring_close(file);
+}
+
+// TEST SUITE 18
+ring_t *msg_ring;
+
+// Return 0 on success, non-zero otherwise.
+int init_suite_18()
+{
+    msg_ring = init(MSG_RING_LEN);
+    return 0;
+}
+
+// Return 0 on success, non-zero otherwise.
+int clean_suite_18()
+{
+    clean(msg_ring);
+    return 0;
+}
+
+/* Send and receive whole messages, including an empty one, and check that a
+   full ring, an oversized message and a small destination are refused. */
+void testMSG_SEND_RECV(void)
+{
+    char buf[MSG_RING_LEN];
+    size_t len;
+    CU_ASSERT(0 == ring_msg_recv(msg_ring, buf, sizeof(buf), &len));
+    CU_ASSERT(1 == ring_msg_send(msg_ring, "hello", 5)); // 12 bytes
+    CU_ASSERT(1 == ring_msg_send(msg_ring, "", 0)); // 4 bytes
+    CU_ASSERT(1 == ring_msg_send(msg_ring, "0123456789a", 11)); // 16 bytes
+    CU_ASSERT(MSG_RING_LEN == entries(msg_ring));
+    CU_ASSERT(0 == ring_msg_send(msg_ring, "x", 1));
+    CU_ASSERT(0 == ring_msg_send(msg_ring, buf, MSG_RING_LEN));
+
+    CU_ASSERT(1 == ring_msg_recv(msg_ring, buf, sizeof(buf), &len));
+    CU_ASSERT(5 == len);
+    CU_ASSERT(0 == memcmp(buf, "hello", 5));
+    CU_ASSERT(1 == ring_msg_recv(msg_ring, buf, sizeof(buf), &len));
+    CU_ASSERT(0 == len);
+    CU_ASSERT(0 == ring_msg_recv(msg_ring, buf, 4, &len));
+    CU_ASSERT(11 == len);
+    CU_ASSERT(1 == ring_msg_recv(msg_ring, buf, sizeof(buf), &len));
+    CU_ASSERT(0 == memcmp(buf, "0123456789a", 11));
+    CU_ASSERT(0 == entries(msg_ring));
+}
+
+/* A message that does not fit before the end of the buffer is padded over to
+   the start, and peek returns it whole and in place. Must be run after
+   testMSG_SEND_RECV, which leaves the indices at 32. */
+void testMSG_WRAP_PADDING(void)
+{
+    char *msg;
+    size_t len;
+    CU_ASSERT(1 == ring_msg_send(msg_ring, "0123456789abcdef", 16)); // 20
+    CU_ASSERT(1 == ring_msg_peek(msg_ring, &msg, &len));
+    ring_msg_release(msg_ring);
+
+    // 12 bytes left before the end; this needs 16.
+    CU_ASSERT(1 == ring_msg_send(msg_ring, "wrapped msg", 11));
+    CU_ASSERT(28 == entries(msg_ring));
+    CU_ASSERT(1 == ring_msg_peek(msg_ring, &msg, &len));
+    CU_ASSERT(11 == len);
+    CU_ASSERT(msg == msg_ring->Buffer + sizeof(uint32_t));
+    CU_ASSERT(0 == memcmp(msg, "wrapped msg", 11));
+    ring_msg_release(msg_ring);
+    CU_ASSERT(0 == entries(msg_ring));
+}
+
+// Producer thread: send messages of varying length, each filled with its own
+// sequence number.
+void *msg_producer(void *arg)
+{
+    ring_t *ring = arg;
+    char buf[MSG_MAX_LEN];
+    for (int i = 0; i < MSG_NUM_MSGS; i++)
+    {
+        size_t len = i % MSG_MAX_LEN;
+        memset(buf, (char)i, len);
+        while (!ring_msg_send(ring, buf, len)) { sched_yield(); }
+    }
+    return NULL;
+}
+
+/* Stream messages of every length between threads and check each arrives
+   whole, in order, with the right length and contents. */
+void testMSG_STREAM(void)
+{
+    ring_t *ring = init(MSG_STREAM_RING_LEN);
+    pthread_t producer;
+    CU_ASSERT(0 == pthread_create(&producer, NULL, msg_producer, ring));
+
+    int bad = 0;
+    char buf[MSG_MAX_LEN];
+    for (int i = 0; i < MSG_NUM_MSGS; i++)
+    {
+        size_t len;
+        while (!ring_msg_recv(ring, buf, sizeof(buf), &len)) { sched_yield(); }
+        if (len != (size_t)(i % MSG_MAX_LEN)) { bad++; }
+        for (size_t j = 0; j < len; j++)
+        {
+            if (buf[j] != (char)i) { bad++; break; }
+        }
+    }
+
+    CU_ASSERT(0 == pthread_join(producer, NULL));
+    CU_ASSERT(0 == bad);
+    CU_ASSERT(0 == entries(ring));
+    clean(ring);
+}
+
+// TEST SUITE 19
+
+/* Each reader sees the whole stream at its own pace, and the producer is held
+   back by the slowest one. */
+void testBCAST_CURSORS(void)
+{
+    bcast_ring_t *ring = bcast_init(BCAST_RING_LEN, 0);
+    int fast = bcast_subscribe(ring);
+    int slow = bcast_subscribe(ring);
+    char buf[BCAST_RING_LEN];
+
+    CU_ASSERT(10 == bcast_insert_n(ring, "0123456789", 10));
+    CU_ASSERT(10 == bcast_remove_n(ring, fast, buf, sizeof(buf)));
+    CU_ASSERT(0 == memcmp(buf, "0123456789", 10));
+    CU_ASSERT(10 == bcast_entries(ring, slow));
+
+    // Only 6 bytes free while slow still holds all 10.
+    CU_ASSERT(6 == bcast_insert_n(ring, "abcdefgh", 8));
+    CU_ASSERT(4 == bcast_remove_n(ring, slow, buf, 4));
+    CU_ASSERT(0 == memcmp(buf, "0123", 4));
+    CU_ASSERT(4 == bcast_insert_n(ring, "wxyz", 4));
+
+    // A late reader starts at the current end of the stream.
+    int late = bcast_subscribe(ring);
+    CU_ASSERT(0 == bcast_entries(ring, late));
+    CU_ASSERT(6 == bcast_remove_n(ring, slow, buf, 6));
+    CU_ASSERT(0 == memcmp(buf, "456789", 6));
+    CU_ASSERT(10 == bcast_remove_n(ring, fast, buf, sizeof(buf)));
+    CU_ASSERT(0 == memcmp(buf, "abcdefwxyz", 10));
+    bcast_clean(ring);
+}
+
+/* In drop mode a reader a whole ring behind is dropped instead of blocking
+   the producer, and the other readers carry on. */
+void testBCAST_DROP(void)
+{
+    bcast_ring_t *ring = bcast_init(BCAST_RING_LEN, 1);
+    int fast = bcast_subscribe(ring);
+    int slow = bcast_subscribe(ring);
+    char buf[BCAST_RING_LEN];
+
+    CU_ASSERT(12 == bcast_insert_n(ring, "0123456789ab", 12));
+    CU_ASSERT(12 == bcast_remove_n(ring, fast, buf, sizeof(buf)));
+    CU_ASSERT(8 == bcast_insert_n(ring, "cdefghij", 8));
+    CU_ASSERT(bcast_is_dropped(ring, slow));
+    CU_ASSERT(!bcast_is_dropped(ring, fast));
+    CU_ASSERT(0 == bcast_remove_n(ring, slow, buf, sizeof(buf)));
+    CU_ASSERT(8 == bcast_remove_n(ring, fast, buf, sizeof(buf)));
+    CU_ASSERT(0 == memcmp(buf, "cdefghij", 8));
+
+    // Rejoin from the current end.
+    bcast_unsubscribe(ring, slow);
+    CU_ASSERT(slow == bcast_subscribe(ring));
+    CU_ASSERT(2 == bcast_insert_n(ring, "kl", 2));
+    CU_ASSERT(2 == bcast_remove_n(ring, slow, buf, sizeof(buf)));
+    CU_ASSERT(0 == memcmp(buf, "kl", 2));
+    bcast_clean(ring);
+}
+
+typedef struct
+{
+    bcast_ring_t *ring;
+    int reader;
+    int mismatches;
+} bcast_arg_t;
+
+// Reader thread: check the byte sequence, reading in odd-sized chunks.
+void *bcast_reader(void *arg)
+{
+    bcast_arg_t *a = arg;
+    char buf[7];
+    for (int i = 0; i < BCAST_NUM_BYTES; )
+    {
+        size_t k = bcast_remove_n(a->ring, a->reader, buf, sizeof(buf));
+        if (k == 0) { sched_yield(); }
+        for (size_t j = 0; j < k; j++, i++)
+        {
+            if (buf[j] != (char)i) { a->mismatches++; }
+        }
+    }
+    return NULL;
+}
+
+/* Stream bytes to several reader threads at once and check each one gets
+   every byte in order. */
+void testBCAST_THREADS(void)
+{
+    bcast_ring_t *ring = bcast_init(BCAST_RING_LEN, 0);
+    pthread_t readers[BCAST_NUM_READERS];
+    bcast_arg_t args[BCAST_NUM_READERS];
+    for (int i = 0; i < BCAST_NUM_READERS; i++)
+    {
+        args[i].ring = ring;
+        args[i].reader = bcast_subscribe(ring);
+        args[i].mismatches = 0;
+        CU_ASSERT(0 == pthread_create(&readers[i], NULL, bcast_reader,
+                                      &args[i]));
+    }
+
+    char chunk[5];
+    for (int i = 0; i < BCAST_NUM_BYTES; )
+    {
+        int n = 0;
+        for (; n < (int)sizeof(chunk) && i + n < BCAST_NUM_BYTES; n++)
+        {
+            chunk[n] = (char)(i + n);
+        }
+        for (int sent = 0; sent < n; )
+        {
+            size_t k = bcast_insert_n(ring, chunk + sent, n - sent);
+            if (k == 0) { sched_yield(); }
+            sent += k;
+        }
+        i += n;
+    }
+
+    for (int i = 0; i < BCAST_NUM_READERS; i++)
+    {
+        CU_ASSERT(0 == pthread_join(readers[i], NULL));
+        CU_ASSERT(0 == args[i].mismatches);
+    }
+    bcast_clean(ring);
+}
+
+atomic_int bcast_done;
+
+// Drop-mode reader thread: check the bytes it gets until it is dropped or the
+// producer is done.
+void *bcast_drop_reader(void *arg)
+{
+    bcast_arg_t *a = arg;
+    char buf[7];
+    int i = 0;
+    while (!bcast_is_dropped(a->ring, a->reader))
+    {
+        int done = atomic_load(&bcast_done);
+        size_t k = bcast_remove_n(a->ring, a->reader, buf, sizeof(buf));
+        for (size_t j = 0; j < k; j++, i++)
+        {
+            if (buf[j] != (char)i) { a->mismatches++; }
+        }
+        if (k == 0)
+        {
+            if (done) { break; }
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+/* Stream bytes in drop mode, never waiting for the readers, and check each
+   reader gets an unbroken prefix of the stream before it is dropped. Run
+   under ThreadSanitizer with `make unit_test_tsan` to check for data races
+   between the producer and readers it drops mid-copy. */
+void testBCAST_DROP_THREADS(void)
+{
+    bcast_ring_t *ring = bcast_init(BCAST_RING_LEN, 1);
+    pthread_t readers[BCAST_NUM_READERS];
+    bcast_arg_t args[BCAST_NUM_READERS];
+    atomic_store(&bcast_done, 0);
+    for (int i = 0; i < BCAST_NUM_READERS; i++)
+    {
+        args[i].ring = ring;
+        args[i].reader = bcast_subscribe(ring);
+        args[i].mismatches = 0;
+        CU_ASSERT(0 == pthread_create(&readers[i], NULL, bcast_drop_reader,
+                                      &args[i]));
+    }
+
+    char chunk[5];
+    int short_inserts = 0;
+    for (int i = 0; i < BCAST_NUM_BYTES; )
+    {
+        int n = 0;
+        for (; n < (int)sizeof(chunk) && i + n < BCAST_NUM_BYTES; n++)
+        {
+            chunk[n] = (char)(i + n);
+        }
+        if (n != (int)bcast_insert_n(ring, chunk, n)) { short_inserts++; }
+        i += n;
+    }
+    atomic_store(&bcast_done, 1);
+    CU_ASSERT(0 == short_inserts);
+
+    for (int i = 0; i < BCAST_NUM_READERS; i++)
+    {
+        CU_ASSERT(0 == pthread_join(readers[i], NULL));
+        CU_ASSERT(0 == args[i].mismatches);
+    }
+    bcast_clean(ring);
+}
+
+// TEST SUITE 20
+ring_t *stats_ring;
+atomic_int stats_done;
+
+// Return 0 on success, non-zero otherwise.
+int init_suite_20()
+{
+    stats_ring = init(STATS_RING_LEN);
+    return !ring_stats_enable(stats_ring);
+}
+
+// Return 0 on success, non-zero otherwise.
+int clean_suite_20()
+{
+    clean(stats_ring);
+    return 0;
+}
+
+/* Check every kind of call updates the counters: single and bulk inserts and
+   removes, failures on a full and an empty ring, the peak and the occupancy
+   histogram. */
+void testSTATS_COUNTERS(void)
+{
+    ring_stats_snapshot_t snap;
+    char buf[STATS_RING_LEN];
+
+    CU_ASSERT(0 == my_remove(stats_ring, buf));
+    CU_ASSERT(1 == insert(stats_ring, 'a')); // 1 entry
+    CU_ASSERT(5 == insert_n(stats_ring, "bcdef", 5)); // 6 entries
+    CU_ASSERT(2 == insert_n(stats_ring, "ghij", 4)); // 8 entries
+    CU_ASSERT(0 == ring_insert(stats_ring, 'k'));
+    CU_ASSERT(3 == remove_n(stats_ring, buf, 3));
+    CU_ASSERT(1 == ring_remove(stats_ring, buf));
+
+    ring_stats_snapshot(stats_ring, &snap);
+    CU_ASSERT(8 == snap.Inserted);
+    CU_ASSERT(1 == snap.Failed_Inserts);
+    CU_ASSERT(4 == snap.Removed);
+    CU_ASSERT(1 == snap.Failed_Removes);
+    CU_ASSERT(STATS_RING_LEN == snap.Peak);
+    CU_ASSERT(1 == snap.Hist[1]); // 1
+    CU_ASSERT(1 == snap.Hist[3]); // 4..7
+    CU_ASSERT(2 == snap.Hist[4]); // 8..15
+
+    CU_ASSERT(4 == remove_n(stats_ring, buf, sizeof(buf)));
+    CU_ASSERT(0 == entries(stats_ring));
+}
+
+RING_DEFINE(stats_static, STATIC_RING_LEN)
+
+/* Enable stats and latency stamps on a RING_DEFINE() ring and check clean()
+   detaches them along with emptying the ring. */
+void testSTATS_CLEAN_STATIC(void)
+{
+    CU_ASSERT(1 == ring_stats_enable_latency(&stats_static_ring));
+    CU_ASSERT(1 == stats_static_insert('a'));
+    clean(&stats_static_ring);
+    CU_ASSERT(NULL == stats_static_ring.Stats);
+    CU_ASSERT(0 == entries(&stats_static_ring));
+}
+
+// Producer thread: push bytes one at a time, retrying while full.
+void *stats_producer(void *arg)
+{
+    for (int i = 0; i < STATS_NUM_BYTES; i++)
+    {
+        while (!ring_insert(stats_ring, (char)i)) { sched_yield(); }
+    }
+    atomic_store(&stats_done, 1);
+    return NULL;
+}
+
+// Sum of the histogram buckets: the number of insert calls.
+size_t stats_calls(ring_stats_snapshot_t *snap)
+{
+    size_t calls = 0;
+    for (size_t b = 0; b < RING_STATS_BUCKETS; b++)
+    {
+        calls += snap->Hist[b];
+    }
+    return calls;
+}
+
+/* Take snapshots while a producer runs. Every insert call lands in exactly one
+   histogram bucket, and here each call moves one byte or fails, so in a
+   consistent snapshot the buckets keep adding up to the inserts plus failed
+   inserts. */
+void testSTATS_SNAPSHOT(void)
+{
+    ring_stats_snapshot_t base;
+    ring_stats_snapshot(stats_ring, &base);
+    // Bulk inserts by earlier tests moved more bytes than calls.
+    size_t offset = base.Inserted + base.Failed_Inserts - stats_calls(&base);
+    atomic_store(&stats_done, 0);
+
+    pthread_t producer;
+    CU_ASSERT(0 == pthread_create(&producer, NULL, stats_producer, NULL));
+
+    int torn = 0;
+    char c;
+    while (!atomic_load(&stats_done) || entries(stats_ring))
+    {
+        ring_remove(stats_ring, &c);
+
+        ring_stats_snapshot_t snap;
+        ring_stats_snapshot(stats_ring, &snap);
+        if (stats_calls(&snap) + offset !=
+            snap.Inserted + snap.Failed_Inserts)
+        {
+            torn++;
+        }
+    }
+
+    CU_ASSERT(0 == pthread_join(producer, NULL));
+    CU_ASSERT(0 == torn);
+
+    ring_stats_snapshot_t snap;
+    ring_stats_snapshot(stats_ring, &snap);
+    CU_ASSERT(base.Inserted + STATS_NUM_BYTES == snap.Inserted);
+    CU_ASSERT(snap.Inserted == snap.Removed);
+}
+
+// TEST SUITE 21
+ring_t *lat_ring;
+
+// Return 0 on success, non-zero otherwise.
+int init_suite_21()
+{
+    lat_ring = init(LAT_RING_LEN);
+    return !ring_stats_enable_latency(lat_ring);
+}
+
+// Return 0 on success, non-zero otherwise.
+int clean_suite_21()
+{
+    clean(lat_ring);
+    return 0;
+}
+
+/* Time entries that sit in the ring for a known sleep. A batch is timed once,
+   when its first entry is removed, and entries still in the ring are not
+   timed. */
+void testLAT_WAIT(void)
+{
+    ring_stats_snapshot_t snap;
+    char buf[LAT_RING_LEN];
+
+    CU_ASSERT(4 == insert_n(lat_ring, "abcd", 4));
+    CU_ASSERT(1 == insert(lat_ring, 'e'));
+    usleep(LAT_SLEEP_US);
+    CU_ASSERT(2 == remove_n(lat_ring, buf, 2)); // times the batch
+    CU_ASSERT(2 == remove_n(lat_ring, buf, 2)); // rest of the batch
+    CU_ASSERT(1 == insert(lat_ring, 'f'));
+
+    ring_stats_snapshot(lat_ring, &snap);
+    size_t timed = 0;
+    for (size_t b = 0; b < RING_LAT_BUCKETS; b++)
+    {
+        timed += snap.Lat_Hist[b];
+    }
+    CU_ASSERT(1 == timed);
+    CU_ASSERT(ring_stats_percentile(&snap, 50) >= LAT_SLEEP_US * 1000ull);
+
+    // 'e' and 'f'.
+    CU_ASSERT(2 == remove_n(lat_ring, buf, sizeof(buf)));
+    ring_stats_snapshot(lat_ring, &snap);
+    timed = 0;
+    for (size_t b = 0; b < RING_LAT_BUCKETS; b++)
+    {
+        timed += snap.Lat_Hist[b];
+    }
+    CU_ASSERT(3 == timed);
+}
+
+// Number of entries timed so far.
+size_t lat_timed(ring_stats_snapshot_t *snap)
+{
+    size_t timed = 0;
+    for (size_t b = 0; b < RING_LAT_BUCKETS; b++)
+    {
+        timed += snap->Lat_Hist[b];
+    }
+    return timed;
+}
+
+/* Time entries across auto-grow, which moves the indices back to 0 and needs
+   more stamps than the original ring had room for. Every insert call must
+   still be timed once, and only the batch queued before the sleep waited
+   that long. */
+void testLAT_GROW(void)
+{
+    ring_stats_snapshot_t snap;
+    char buf[LAT_GROW_MAX_LEN];
+    ring_t *ring = init(LAT_RING_LEN);
+    CU_ASSERT(1 == ring_stats_enable_latency(ring));
+    ring_set_autogrow(ring, LAT_GROW_MAX_LEN, 0);
+
+    // Move the indices away from 0, then leave a batch waiting.
+    CU_ASSERT(10 == insert_n(ring, "0123456789", 10));
+    CU_ASSERT(10 == remove_n(ring, buf, 10));
+    CU_ASSERT(12 == insert_n(ring, "abcdefghijkl", 12));
+    usleep(LAT_SLEEP_US);
+
+    // Grows to 32, then to 64.
+    for (int i = 0; i < LAT_GROW_INSERTS; i++)
+    {
+        CU_ASSERT(1 == insert(ring, 'x'));
+    }
+    CU_ASSERT(LAT_GROW_MAX_LEN == ring->Length);
+    CU_ASSERT(12 + LAT_GROW_INSERTS == remove_n(ring, buf, sizeof(buf)));
+    CU_ASSERT(0 == memcmp(buf, "abcdefghijkl", 12));
+
+    ring_stats_snapshot(ring, &snap);
+    CU_ASSERT(2 + LAT_GROW_INSERTS == lat_timed(&snap));
+    CU_ASSERT(ring_stats_percentile(&snap, 50) < LAT_SLEEP_US * 1000ull);
+    CU_ASSERT(ring_stats_percentile(&snap, 100) >= LAT_SLEEP_US * 1000ull);
+    clean(ring);
+}
+
+/* Check percentiles on a hand-made histogram: 990 waits of 5 ticks, 9 of
+   about 1000 and 1 of about 10^6. Bucket ends are within 12.5% above. */
+void testLAT_PERCENTILES(void)
+{
+    ring_stats_snapshot_t snap = {0};
+    snap.Lat_Hist[5] = 990;
+    snap.Lat_Hist[(10 - 2) * RING_LAT_STEPS] = 9; // 1024..1151
+    snap.Lat_Hist[(19 - 2) * RING_LAT_STEPS + 7] = 1; // 983040..1048575
+
+    CU_ASSERT(5 == ring_stats_percentile(&snap, 50));
+    CU_ASSERT(5 == ring_stats_percentile(&snap, 99));
+    CU_ASSERT(1151 == ring_stats_percentile(&snap, 99.9));
+    CU_ASSERT(1048575 == ring_stats_percentile(&snap, 100));
+}
+
+// TEST SUITE 22
+ring_t *find_ring;
+
+// Return 0 on success, non-zero otherwise.
+int init_suite_22()
+{
+    find_ring = init(FIND_RING_LEN);
+    return 0;
+}
+
+// Return 0 on success, non-zero otherwise.
+int clean_suite_22()
+{
+    clean(find_ring);
+    return 0;
+}
+
+// Move both indices to start, leaving the ring empty.
+void find_reset(size_t start)
+{
+    atomic_store(&find_ring->Ini, start);
+    atomic_store(&find_ring->Outi, start);
+    find_ring->Outi_Cache = start;
+    find_ring->Ini_Cache = start;
+}
+
+/* Fill FIND_SPAN bytes starting at every offset around the wrap point, with
+   one '\n' at every position, and check ring_find() returns that position
+   in each case, including the vector and tail parts of each span. */
+void testFIND_BYTE(void)
+{
+    char buf[FIND_SPAN];
+    memset(buf, 'x', sizeof(buf));
+    int bad = 0;
+    for (size_t start = FIND_RING_LEN - 40; start < FIND_RING_LEN + 8; start++)
+    {
+        for (size_t pos = 0; pos < FIND_SPAN; pos++)
+        {
+            find_reset(start);
+            buf[pos] = '\n';
+            insert_n(find_ring, buf, sizeof(buf));
+            buf[pos] = 'x';
+            if (ring_find(find_ring, '\n') != (ptrdiff_t)pos) { bad++; }
+        }
+    }
+    CU_ASSERT(0 == bad);
+
+    find_reset(FIND_RING_LEN - 3);
+    CU_ASSERT(-1 == ring_find(find_ring, '\n'));
+    CU_ASSERT(FIND_SPAN == insert_n(find_ring, buf, sizeof(buf)));
+    CU_ASSERT(-1 == ring_find(find_ring, '\n'));
+    CU_ASSERT(0 == ring_find(find_ring, 'x'));
+}
+
+/* Find the first of several delimiters, with the set compared by vectors and
+   by the lookup table, and check a full ring is searched to its last byte. */
+void testFIND_ANY(void)
+{
+    char line[] = "abc,def;ghi\r\nxyz";
+    find_reset(FIND_RING_LEN - 5);
+    CU_ASSERT(sizeof(line) - 1 == insert_n(find_ring, line, sizeof(line) - 1));
+    CU_ASSERT(11 == ring_find_any(find_ring, "\r\n"));
+    CU_ASSERT(3 == ring_find_any(find_ring, ";,"));
+    CU_ASSERT(13 == ring_find_any(find_ring, "zyx0123456789"));
+    CU_ASSERT(-1 == ring_find_any(find_ring, "0123456789ABCDEF"));
+
+    // A full ring, with the only match in the last byte.
+    char *big = malloc(FIND_RING_LEN);
+    memset(big, 'x', FIND_RING_LEN);
+    big[FIND_RING_LEN - 1] = '\n';
+    find_reset(12345);
+    CU_ASSERT(FIND_RING_LEN == insert_n(find_ring, big, FIND_RING_LEN));
+    CU_ASSERT(FIND_RING_LEN - 1 == ring_find(find_ring, '\n'));
+    CU_ASSERT(FIND_RING_LEN - 1 == ring_find_any(find_ring, "\r\n"));
+    free(big);
+    find_reset(0);
+}
+
+/* Search part of the readable bytes, across the wrap point, and check
+   offsets are still counted from Outi and bytes outside the range are
+   ignored. */
+void testFIND_RANGE(void)
+{
+    find_reset(FIND_RING_LEN - 3);
+    CU_ASSERT(7 == insert_n(find_ring, "a\nb\rc\nd", 7));
+    CU_ASSERT(-1 == ring_find_range(find_ring, '\n', 0, 1));
+    CU_ASSERT(1 == ring_find_range(find_ring, '\n', 0, 2));
+    CU_ASSERT(5 == ring_find_range(find_ring, '\n', 2, SIZE_MAX));
+    CU_ASSERT(-1 == ring_find_range(find_ring, '\n', 6, SIZE_MAX));
+    CU_ASSERT(-1 == ring_find_range(find_ring, '\n', 3, 3));
+    CU_ASSERT(3 == ring_find_any_range(find_ring, "\r\n", 2, 6));
+    CU_ASSERT(5 == ring_find_any_range(find_ring, "\r\n", 4, 6));
+    CU_ASSERT(-1 == ring_find_any_range(find_ring, "\r\n", 4, 5));
+    find_reset(0);
+}
+
+// TEST SUITE 23
+ring_t *frame_ring;
+char frame_scratch[FRAME_MAX_LEN];
+
+// Return 0 on success, non-zero otherwise.
+int init_suite_23()
+{
+    frame_ring = init(FRAME_RING_LEN);
+    return 0;
+}
+
+// Return 0 on success, non-zero otherwise.
+int clean_suite_23()
+{
+    clean(frame_ring);
+    return 0;
+}
+
+// Move both indices to start, leaving the ring empty.
+void frame_reset(size_t start)
+{
+    atomic_store(&frame_ring->Ini, start);
+    atomic_store(&frame_ring->Outi, start);
+    frame_ring->Outi_Cache = start;
+    frame_ring->Ini_Cache = start;
+}
+
+/* Read CR, LF and CR LF lines, in place and across the wrap, and wait for a
+   line that is not yet complete. */
+void testFRAME_LINE(void)
+{
+    frame_reader_t fr;
+    char *frame;
+    size_t len;
+    frame_init(&fr, frame_ring, FRAME_LINE, frame_scratch, FRAME_MAX_LEN);
+
+    frame_reset(0);
+    insert_n(frame_ring, "ok\r\nAT+X=1\n\nhal", 15);
+    CU_ASSERT(1 == frame_next(&fr, &frame, &len));
+    CU_ASSERT(2 == len && 0 == memcmp(frame, "ok", 2));
+    CU_ASSERT(frame == frame_ring->Buffer); // a view, not a copy
+    CU_ASSERT(1 == frame_next(&fr, &frame, &len));
+    CU_ASSERT(6 == len && 0 == memcmp(frame, "AT+X=1", 6));
+    CU_ASSERT(0 == frame_next(&fr, &frame, &len));
+    CU_ASSERT(3 == entries(frame_ring));
+    insert_n(frame_ring, "f\r", 2);
+    CU_ASSERT(1 == frame_next(&fr, &frame, &len));
+    CU_ASSERT(4 == len && 0 == memcmp(frame, "half", 4));
+    frame_release(&fr);
+    CU_ASSERT(0 == entries(frame_ring));
+
+    // A line across the wrap is copied out.
+    frame_reset(FRAME_RING_LEN - 3);
+    insert_n(frame_ring, "wrapped\n", 8);
+    CU_ASSERT(1 == frame_next(&fr, &frame, &len));
+    CU_ASSERT(7 == len && 0 == memcmp(frame, "wrapped", 7));
+    CU_ASSERT(frame == frame_scratch);
+    frame_release(&fr);
+    CU_ASSERT(0 == entries(frame_ring));
+    CU_ASSERT(0 == fr.Dropped);
+}
+
+/* Drop a line longer than the limit, both when its end is in the ring and
+   when it is not, and resync on the line after it. */
+void testFRAME_OVERSIZE(void)
+{
+    frame_reader_t fr;
+    char *frame;
+    size_t len;
+    frame_init(&fr, frame_ring, FRAME_LINE, frame_scratch, FRAME_MAX_LEN);
+
+    frame_reset(0);
+    insert_n(frame_ring, "0123456789abcdefg\nok\n", 21);
+    CU_ASSERT(1 == frame_next(&fr, &frame, &len));
+    CU_ASSERT(2 == len && 0 == memcmp(frame, "ok", 2));
+    CU_ASSERT(1 == fr.Dropped);
+
+    // No delimiter within the limit: skip bytes as they arrive.
+    insert_n(frame_ring, "0123456789abcdefghij", 20);
+    CU_ASSERT(0 == frame_next(&fr, &frame, &len));
+    CU_ASSERT(0 == entries(frame_ring));
+    insert_n(frame_ring, "klm\nnext\n", 9);
+    CU_ASSERT(1 == frame_next(&fr, &frame, &len));
+    CU_ASSERT(4 == len && 0 == memcmp(frame, "next", 4));
+    CU_ASSERT(2 == fr.Dropped);
+    frame_release(&fr);
+}
+
+/* Feed a line one byte at a time, as a UART ISR would, and check the reader
+   remembers how far it has searched instead of rescanning the line. */
+void testFRAME_PARTIAL(void)
+{
+    frame_reader_t fr;
+    char *frame;
+    size_t len;
+    frame_init(&fr, frame_ring, FRAME_LINE, frame_scratch, FRAME_MAX_LEN);
+
+    frame_reset(0);
+    const char *line = "partial";
+    for (size_t i = 0; line[i] != '\0'; i++)
+    {
+        CU_ASSERT(1 == insert(frame_ring, line[i]));
+        CU_ASSERT(0 == frame_next(&fr, &frame, &len));
+        CU_ASSERT(i + 1 == fr.Scanned);
+    }
+    CU_ASSERT(1 == insert(frame_ring, '\n'));
+    CU_ASSERT(1 == frame_next(&fr, &frame, &len));
+    CU_ASSERT(7 == len && 0 == memcmp(frame, "partial", 7));
+    CU_ASSERT(0 == fr.Scanned);
+    frame_release(&fr);
+    CU_ASSERT(0 == entries(frame_ring));
+    CU_ASSERT(0 == fr.Dropped);
+}
+
+atomic_int frame_done;
+
+// Producer thread: send numbered lines one byte at a time, as a UART ISR
+// would.
+void *frame_producer(void *arg)
+{
+    ring_t *ring = arg;
+    char line[FRAME_MAX_LEN];
+    for (int i = 0; i < FRAME_STREAM_LINES; i++)
+    {
+        int n = snprintf(line, sizeof(line), "line%d\n", i);
+        for (int k = 0; k < n; k++)
+        {
+            while (!ring_insert(ring, line[k])) { sched_yield(); }
+        }
+    }
+    atomic_store(&frame_done, 1);
+    return NULL;
+}
+
+/* Read lines while a producer thread is still adding bytes, so delimiters
+   arrive while frame_next() searches. Every line must come out intact, and
+   none may be merged with the next one or dropped. */
+void testFRAME_STREAM(void)
+{
+    ring_t *ring = init(FRAME_STREAM_RING_LEN);
+    frame_reader_t fr;
+    char *frame;
+    size_t len;
+    char want[FRAME_MAX_LEN];
+    frame_init(&fr, ring, FRAME_LINE, frame_scratch, FRAME_MAX_LEN);
+    atomic_store(&frame_done, 0);
+
+    pthread_t producer;
+    CU_ASSERT(0 == pthread_create(&producer, NULL, frame_producer, ring));
+
+    // A lost delimiter merges two lines, so stop once the producer is done
+    // and no complete line is left rather than waiting for every line.
+    int mismatches = 0;
+    int received = 0;
+    for (;;)
+    {
+        int done = atomic_load(&frame_done);
+        if (!frame_next(&fr, &frame, &len))
+        {
+            if (done) { break; }
+            sched_yield();
+            continue;
+        }
+        int n = snprintf(want, sizeof(want), "line%d", received);
+        if (len != (size_t)n || memcmp(frame, want, n) != 0) { mismatches++; }
+        received++;
+    }
+
+    CU_ASSERT(0 == pthread_join(producer, NULL));
+    CU_ASSERT(FRAME_STREAM_LINES == received);
+    CU_ASSERT(0 == mismatches);
+    CU_ASSERT(0 == fr.Dropped);
+    CU_ASSERT(0 == entries(ring));
+    clean(ring);
+}
+
+/* Decode SLIP escapes, in place and across the wrap, and drop a frame with a
+   bad escape. */
+void testFRAME_SLIP(void)
+{
+    frame_reader_t fr;
+    char *frame;
+    size_t len;
+    frame_init(&fr, frame_ring, FRAME_SLIP, frame_scratch, FRAME_MAX_LEN);
+
+    char raw[] = { 0xC0, 'a', 0xDB, 0xDC, 'b', 0xDB, 0xDD, 0xC0,
+                   'x', 0xDB, 'y', 0xC0, 'z', 0xC0 };
+    char want[] = { 'a', 0xC0, 'b', 0xDB };
+    for (size_t start = 0; start < FRAME_RING_LEN; start += 7)
+    {
+        frame_reset(start);
+        insert_n(frame_ring, raw, sizeof(raw));
+        fr.Dropped = 0;
+        CU_ASSERT(1 == frame_next(&fr, &frame, &len));
+        CU_ASSERT(4 == len && 0 == memcmp(frame, want, 4));
+        CU_ASSERT(1 == frame_next(&fr, &frame, &len));
+        CU_ASSERT(1 == len && 'z' == frame[0]);
+        CU_ASSERT(1 == fr.Dropped);
+        CU_ASSERT(0 == frame_next(&fr, &frame, &len));
+        CU_ASSERT(0 == entries(frame_ring));
+    }
+}
+
+/* Decode COBS frames holding zeros, in place and across the wrap, and drop a
+   frame whose code byte runs past its end. */
+void testFRAME_COBS(void)
+{
+    frame_reader_t fr;
+    char *frame;
+    size_t len;
+    frame_init(&fr, frame_ring, FRAME_COBS, frame_scratch, FRAME_MAX_LEN);
+
+    // 11 22 00 33 and 00 00, with a bad frame between them.
+    char raw[] = { 3, 0x11, 0x22, 2, 0x33, 0, 5, 1, 0,
+                   1, 1, 1, 0 };
+    char want[] = { 0x11, 0x22, 0, 0x33 };
+    for (size_t start = 0; start < FRAME_RING_LEN; start += 5)
+    {
+        frame_reset(start);
+        insert_n(frame_ring, raw, sizeof(raw));
+        fr.Dropped = 0;
+        CU_ASSERT(1 == frame_next(&fr, &frame, &len));
+        CU_ASSERT(4 == len && 0 == memcmp(frame, want, 4));
+        CU_ASSERT(1 == frame_next(&fr, &frame, &len));
+        CU_ASSERT(2 == len && 0 == frame[0] && 0 == frame[1]);
+        CU_ASSERT(1 == fr.Dropped);
+        frame_release(&fr);
+        CU_ASSERT(0 == entries(frame_ring));
+    }
+}
+
+// TEST SUITE 24
+ring_t *hist_ring;
+
+// Return 0 on success, non-zero otherwise.
+int init_suite_24()
+{
+    hist_ring = init(HIST_RING_LEN);
+    return 0;
+}
+
+// Return 0 on success, non-zero otherwise.
+int clean_suite_24()
+{
+    clean(hist_ring);
+    return 0;
+}
+
+/* Count buffers on both sides of HIST_BULK_MIN, at odd offsets and lengths
+   and with runs of one value, and check against a byte loop. Bytes above 127
+   must land in hist[128..255]. */
+void testHIST_BYTES(void)
+{
+    size_t sizes[] = { 0, 1, 7, HIST_BULK_MIN - 1, HIST_BULK_MIN, 5003 };
+    char *buf = malloc(5003 + 3);
+    for (size_t i = 0; i < 5003 + 3; i++)
+    {
+        buf[i] = (i % 3 == 0) ? (char)0xFF : (char)(i * 7);
+    }
+
+    int bad = 0;
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+    {
+        int hist[HIST_BINS] = { 0 };
+        int want[HIST_BINS] = { 0 };
+        for (size_t i = 0; i < sizes[s]; i++)
+        {
+            want[(unsigned char)buf[3 + i]]++;
+        }
+        hist_bytes(hist, buf + 3, sizes[s]);
+        if (memcmp(hist, want, sizeof(hist)) != 0) { bad++; }
+    }
+    CU_ASSERT(0 == bad);
+
+    // Counts add to what is already there.
+    int hist[HIST_BINS] = { 0 };
+    memset(buf, 0x80, 2000);
+    hist_bytes(hist, buf, 2000);
+    hist_bytes(hist, buf, 10);
+    CU_ASSERT(2010 == hist[0x80]);
+    CU_ASSERT(0 == hist[0]);
+    free(buf);
+}
+
+/* Count the readable bytes of a ring across the wrap point, without removing
+   them. */
+void testHIST_RING(void)
+{
+    char buf[3000];
+    for (size_t i = 0; i < sizeof(buf); i++) { buf[i] = (char)(i & 0xFF); }
+
+    size_t start = HIST_RING_LEN - 1000;
+    atomic_store(&hist_ring->Ini, start);
+    atomic_store(&hist_ring->Outi, start);
+    hist_ring->Outi_Cache = start;
+    hist_ring->Ini_Cache = start;
+    CU_ASSERT(sizeof(buf) == insert_n(hist_ring, buf, sizeof(buf)));
+
+    int hist[HIST_BINS] = { 0 };
+    ring_hist(hist_ring, hist);
+    int bad = 0;
+    for (int b = 0; b < HIST_BINS; b++)
+    {
+        int want = 3000 / HIST_BINS + (b < 3000 % HIST_BINS);
+        if (hist[b] != want) { bad++; }
+    }
+    CU_ASSERT(0 == bad);
+    CU_ASSERT(sizeof(buf) == entries(hist_ring));
+}
+
 int main(void)
 {
     // Initialize the CUnit test registry.
@@ -195,31 +2328,189 @@ int main(void)
         return CU_get_error();
     }
 
-    // Add a suite to the registry.
-    CU_pSuite pSuite = NULL;
-    pSuite = CU_add_suite("Single Ring Buffer, Suite 1", init_suite_1, \
-                          clean_suite_1);
-    pSuite = CU_add_suite("Multiple Ring Buffers, Suite 2", init_suite_2, \
-                          clean_suite_2);
-    if (NULL == pSuite)
+    // Add suites to the registry.
+    CU_pSuite pSuite1 = CU_add_suite("Single Ring Buffer, Suite 1", \
+                                     init_suite_1, clean_suite_1);
+    CU_pSuite pSuite2 = CU_add_suite("Multiple Ring Buffers, Suite 2", \
+                                     init_suite_2, clean_suite_2);
+    CU_pSuite pSuite3 = CU_add_suite("SPSC Ring Buffer, Suite 3", \
+                                     init_suite_3, clean_suite_3);
+    CU_pSuite pSuite4 = CU_add_suite("Bulk Ring Buffer, Suite 4", \
+                                     init_suite_4, clean_suite_4);
+    CU_pSuite pSuite5 = CU_add_suite("Static Ring Buffer, Suite 5", \
+                                     NULL, NULL);
+    CU_pSuite pSuite6 = CU_add_suite("Ring Trace, Suite 6", NULL, NULL);
+    CU_pSuite pSuite7 = CU_add_suite("MPMC Ring Buffer, Suite 7", \
+                                     init_suite_7, clean_suite_7);
+    CU_pSuite pSuite8 = CU_add_suite("Mirrored Ring Buffer, Suite 8", \
+                                     init_suite_8, clean_suite_8);
+    CU_pSuite pSuite9 = CU_add_suite("Typed Ring Buffer, Suite 9", NULL, NULL);
+    CU_pSuite pSuite10 = CU_add_suite("Overwrite Ring Buffer, Suite 10", \
+                                      init_suite_10, clean_suite_10);
+    CU_pSuite pSuite11 = CU_add_suite("Index Wraparound, Suite 11", \
+                                      init_suite_11, clean_suite_11);
+    CU_pSuite pSuite12 = CU_add_suite("Blocking Ring Buffer, Suite 12", \
+                                      init_suite_12, clean_suite_12);
+    CU_pSuite pSuite13 = CU_add_suite("Event Ring Buffer, Suite 13", \
+                                      init_suite_13, clean_suite_13);
+    CU_pSuite pSuite14 = CU_add_suite("Ring Arena, Suite 14", \
+                                      init_suite_14, clean_suite_14);
+    CU_pSuite pSuite15 = CU_add_suite("Resizable Ring Buffer, Suite 15", \
+                                      init_suite_15, clean_suite_15);
+    CU_pSuite pSuite16 = CU_add_suite("Shared-Memory Ring Buffer, Suite 16", \
+                                      init_suite_16, clean_suite_16);
+    CU_pSuite pSuite17 = CU_add_suite("File-Backed Ring Buffer, Suite 17", \
+                                      init_suite_17, clean_suite_17);
+    CU_pSuite pSuite18 = CU_add_suite("Message Queue, Suite 18", \
+                                      init_suite_18, clean_suite_18);
+    CU_pSuite pSuite19 = CU_add_suite("Broadcast Ring Buffer, Suite 19", \
+                                      NULL, NULL);
+    CU_pSuite pSuite20 = CU_add_suite("Ring Stats, Suite 20", \
+                                      init_suite_20, clean_suite_20);
+    CU_pSuite pSuite21 = CU_add_suite("Ring Latency, Suite 21", \
+                                      init_suite_21, clean_suite_21);
+    CU_pSuite pSuite22 = CU_add_suite("Ring Search, Suite 22", \
+                                      init_suite_22, clean_suite_22);
+    CU_pSuite pSuite23 = CU_add_suite("Ring Framing, Suite 23", \
+                                      init_suite_23, clean_suite_23);
+    CU_pSuite pSuite24 = CU_add_suite("Byte Histogram, Suite 24", \
+                                      init_suite_24, clean_suite_24);
+    if (NULL == pSuite1 || NULL == pSuite2 || NULL == pSuite3 ||
+        NULL == pSuite4 || NULL == pSuite5 || NULL == pSuite6 ||
+        NULL == pSuite7 || NULL == pSuite8 || NULL == pSuite9 ||
+        NULL == pSuite10 || NULL == pSuite11 || NULL == pSuite12 ||
+        NULL == pSuite13 || NULL == pSuite14 || NULL == pSuite15 ||
+        NULL == pSuite16 || NULL == pSuite17 || NULL == pSuite18 ||
+        NULL == pSuite19 || NULL == pSuite20 || NULL == pSuite21 ||
+        NULL == pSuite22 || NULL == pSuite23 || NULL == pSuite24)
     {
         CU_cleanup_registry();
         return CU_get_error();
     }
 
-    // Add tests to the suite.
-    if ((NULL == CU_add_test(pSuite, "test of insert", testINSERT)) ||
-        (NULL == CU_add_test(pSuite, "test of remove", testREMOVE)) ||
-        (NULL == CU_add_test(pSuite, "test of mix of insert and remove", \
+    // Add tests to the suites.
+    if ((NULL == CU_add_test(pSuite1, "test of insert", testINSERT)) ||
+        (NULL == CU_add_test(pSuite1, "test of remove", testREMOVE)) ||
+        (NULL == CU_add_test(pSuite1, "test of mix of insert and remove", \
                                             testINSERT_AND_REMOVE)) ||
-        (NULL == CU_add_test(pSuite, "test of insert into full buffer",  \
+        (NULL == CU_add_test(pSuite1, "test of insert into full buffer",  \
                                         testINSERT_INTO_FULL_BUFF)) ||
-        (NULL == CU_add_test(pSuite, "test of remove from empty buffer",
+        (NULL == CU_add_test(pSuite1, "test of remove from empty buffer",
                                       testREMOVE_FROM_EMPTY_BUFF)) ||
-        (NULL == CU_add_test(pSuite, "test of insert to mult buffers", \
+        (NULL == CU_add_test(pSuite2, "test of insert to mult buffers", \
                                       testMULTIPLE_BUFFS_INSERT)) ||
-        (NULL == CU_add_test(pSuite, "test of remove from mult buffers", \
-                                      testMULTIPLE_BUFFS_REMOVE)))
+        (NULL == CU_add_test(pSuite2, "test of remove from mult buffers", \
+                                      testMULTIPLE_BUFFS_REMOVE)) ||
+        (NULL == CU_add_test(pSuite3, "test of spsc across threads", \
+                                      testSPSC_ACROSS_THREADS)) ||
+        (NULL == CU_add_test(pSuite4, "test of partial bulk insert/remove", \
+                                      testBULK_PARTIAL)) ||
+        (NULL == CU_add_test(pSuite4, "test of bulk insert/remove at wrap", \
+                                      testBULK_WRAP)) ||
+        (NULL == CU_add_test(pSuite4, "test of reserve and commit", \
+                                      testRESERVE_COMMIT)) ||
+        (NULL == CU_add_test(pSuite4, "test of peek and consume", \
+                                      testPEEK_CONSUME)) ||
+        (NULL == CU_add_test(pSuite5, "test of statically defined ring", \
+                                      testSTATIC_RING)) ||
+        (NULL == CU_add_test(pSuite6, "test of trace records", \
+                                      testTRACE_RECORDS)) ||
+        (NULL == CU_add_test(pSuite7, "test of mpmc in one thread", \
+                                      testMPMC_SINGLE_THREAD)) ||
+        (NULL == CU_add_test(pSuite7, "test of mpmc across threads", \
+                                      testMPMC_ACROSS_THREADS)) ||
+        (NULL == CU_add_test(pSuite8, "test of mirrored contiguous spans", \
+                                      testMIRROR_CONTIGUOUS)) ||
+        (NULL == CU_add_test(pSuite9, "test of typed ring of structs", \
+                                      testTYPED_RING)) ||
+        (NULL == CU_add_test(pSuite10, "test of overwrite on insert", \
+                                       testOVERWRITE_INSERT)) ||
+        (NULL == CU_add_test(pSuite10, "test of overwrite on bulk insert", \
+                                       testOVERWRITE_INSERT_N)) ||
+        (NULL == CU_add_test(pSuite10, "test of overwrite across threads", \
+                                       testOVERWRITE_ACROSS_THREADS)) ||
+        (NULL == CU_add_test(pSuite11, "test of full/empty across wrap", \
+                                       testWRAP_FULL_EMPTY)) ||
+        (NULL == CU_add_test(pSuite11, "test of soak across wrap", \
+                                       testWRAP_SOAK)) ||
+        (NULL == CU_add_test(pSuite12, "test of wait sleeps until data", \
+                                       testWAIT_SLEEP_AND_WAKE)) ||
+        (NULL == CU_add_test(pSuite12, "test of blocking stream", \
+                                       testWAIT_BLOCKING_STREAM)) ||
+        (NULL == CU_add_test(pSuite13, "test of epoll on readable fds", \
+                                       testEVENT_EPOLL_READABLE)) ||
+        (NULL == CU_add_test(pSuite13, "test of rearm recheck", \
+                                       testEVENT_REARM_RECHECK)) ||
+        (NULL == CU_add_test(pSuite13, "test of writable fd", \
+                                       testEVENT_WRITABLE)) ||
+        (NULL == CU_add_test(pSuite14, "test of arena alloc", \
+                                       testARENA_ALLOC)) ||
+        (NULL == CU_add_test(pSuite14, "test of arena rings", \
+                                       testARENA_RINGS)) ||
+        (NULL == CU_add_test(pSuite15, "test of resize with wrapped data", \
+                                       testRESIZE_WRAPPED)) ||
+        (NULL == CU_add_test(pSuite15, "test of auto-grow and shrink", \
+                                       testRESIZE_AUTOGROW)) ||
+        (NULL == CU_add_test(pSuite15, "test of auto-grow without shrink", \
+                                       testRESIZE_NO_SHRINK)) ||
+        (NULL == CU_add_test(pSuite16, "test of shared ring attach", \
+                                       testSHM_ATTACH)) ||
+        (NULL == CU_add_test(pSuite16, "test of cross-process stream", \
+                                       testSHM_CROSS_PROCESS)) ||
+        (NULL == CU_add_test(pSuite17, "test of file ring reopen", \
+                                       testFILE_REOPEN)) ||
+        (NULL == CU_add_test(pSuite17, "test of file ring after crash", \
+                                       testFILE_CRASH)) ||
+        (NULL == CU_add_test(pSuite17, "test of unformatted file ring", \
+                                       testFILE_UNFORMATTED)) ||
+        (NULL == CU_add_test(pSuite18, "test of message send and recv", \
+                                       testMSG_SEND_RECV)) ||
+        (NULL == CU_add_test(pSuite18, "test of message wrap padding", \
+                                       testMSG_WRAP_PADDING)) ||
+        (NULL == CU_add_test(pSuite18, "test of message stream", \
+                                       testMSG_STREAM)) ||
+        (NULL == CU_add_test(pSuite19, "test of broadcast cursors", \
+                                       testBCAST_CURSORS)) ||
+        (NULL == CU_add_test(pSuite19, "test of broadcast drop mode", \
+                                       testBCAST_DROP)) ||
+        (NULL == CU_add_test(pSuite19, "test of broadcast threads", \
+                                       testBCAST_THREADS)) ||
+        (NULL == CU_add_test(pSuite19, "test of broadcast drop threads", \
+                                       testBCAST_DROP_THREADS)) ||
+        (NULL == CU_add_test(pSuite20, "test of stats counters", \
+                                       testSTATS_COUNTERS)) ||
+        (NULL == CU_add_test(pSuite20, "test of stats snapshots", \
+                                       testSTATS_SNAPSHOT)) ||
+        (NULL == CU_add_test(pSuite20, "test of stats on a static ring", \
+                                       testSTATS_CLEAN_STATIC)) ||
+        (NULL == CU_add_test(pSuite21, "test of latency stamps", \
+                                       testLAT_WAIT)) ||
+        (NULL == CU_add_test(pSuite21, "test of latency percentiles", \
+                                       testLAT_PERCENTILES)) ||
+        (NULL == CU_add_test(pSuite21, "test of latency across auto-grow", \
+                                       testLAT_GROW)) ||
+        (NULL == CU_add_test(pSuite22, "test of find byte", \
+                                       testFIND_BYTE)) ||
+        (NULL == CU_add_test(pSuite22, "test of find any", \
+                                       testFIND_ANY)) ||
+        (NULL == CU_add_test(pSuite22, "test of find range", \
+                                       testFIND_RANGE)) ||
+        (NULL == CU_add_test(pSuite23, "test of line framing", \
+                                       testFRAME_LINE)) ||
+        (NULL == CU_add_test(pSuite23, "test of oversize frame", \
+                                       testFRAME_OVERSIZE)) ||
+        (NULL == CU_add_test(pSuite23, "test of partial frame", \
+                                       testFRAME_PARTIAL)) ||
+        (NULL == CU_add_test(pSuite23, "test of frames across threads", \
+                                       testFRAME_STREAM)) ||
+        (NULL == CU_add_test(pSuite23, "test of SLIP framing", \
+                                       testFRAME_SLIP)) ||
+        (NULL == CU_add_test(pSuite23, "test of COBS framing", \
+                                       testFRAME_COBS)) ||
+        (NULL == CU_add_test(pSuite24, "test of byte histogram", \
+                                       testHIST_BYTES)) ||
+        (NULL == CU_add_test(pSuite24, "test of ring histogram", \
+                                       testHIST_RING)))
     {
         CU_cleanup_registry();
         return CU_get_error();
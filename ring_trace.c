@@ -0,0 +1,64 @@
+/*******************************************************************************
+ *
+ * Copyright (C) 2026 by the ring buffer contributors
+ *
+ ******************************************************************************/
+
+/*
+ * @file ring_trace.c
+ * @brief Binary trace ring for the ring buffer library.
+ *
+ * @date October 16, 2026
+ */
+
+#include "ring_trace.h"
+#include <stdio.h>
+#include <stdatomic.h>
+
+_Static_assert((RING_TRACE_LEN & (RING_TRACE_LEN - 1)) == 0,
+               "RING_TRACE_LEN must be a power of 2");
+
+// Trace ring. Both sides of a ring write records, so slots are claimed with an
+// atomic counter; the oldest records are overwritten once it wraps.
+static ring_trace_rec_t trace_recs[RING_TRACE_LEN];
+static atomic_uint trace_next;
+
+void ring_trace(uint8_t event, uint32_t index, char data)
+{
+    unsigned slot = atomic_fetch_add_explicit(&trace_next, 1,
+                                              memory_order_relaxed);
+    ring_trace_rec_t *rec = &trace_recs[slot & (RING_TRACE_LEN - 1)];
+    rec->Index = index;
+    rec->Event = event;
+    rec->Data = data;
+}
+
+// Copy up to max of the newest records into recs, oldest first. Returns the
+// number copied. For debugging; call while the rings are quiet.
+int ring_trace_snapshot(ring_trace_rec_t *recs, int max)
+{
+    unsigned next = atomic_load_explicit(&trace_next, memory_order_acquire);
+    int count = (next < RING_TRACE_LEN) ? (int)next : RING_TRACE_LEN;
+    if (count > max) { count = max; }
+
+    for (int i = 0; i < count; i++)
+    {
+        recs[i] = trace_recs[(next - count + i) & (RING_TRACE_LEN - 1)];
+    }
+    return count;
+}
+
+// For debugging.
+void ring_trace_dump(void)
+{
+    static const char *names[] = { "?", "insert", "remove", "full", "empty" };
+    ring_trace_rec_t recs[RING_TRACE_LEN];
+    int count = ring_trace_snapshot(recs, RING_TRACE_LEN);
+
+    for (int i = 0; i < count; i++)
+    {
+        uint8_t ev = (recs[i].Event <= RING_EV_EMPTY) ? recs[i].Event : 0;
+        printf("trace: %s char=%c, index=%lu\n", names[ev], recs[i].Data,
+               (unsigned long)recs[i].Index);
+    }
+}
@@ -0,0 +1,69 @@
+/*******************************************************************************
+ *
+ * Copyright (C) 2026 by the ring buffer contributors
+ *
+ ******************************************************************************/
+
+/*
+ * @file ring_trace.h
+ * @brief Compile-time configurable binary tracing for the ring buffer.
+ *
+ * @date October 16, 2026
+ *
+ * Set RING_TRACE_LEVEL when compiling (e.g. make TRACE_LEVEL=2):
+ *   0 (RING_TRACE_OFF)   - trace calls compile to nothing (release builds)
+ *   1 (RING_TRACE_ERROR) - record failed inserts/removes only
+ *   2 (RING_TRACE_ALL)   - also record every successful insert/remove
+ * Records go into a dedicated trace ring that keeps the newest
+ * RING_TRACE_LEN records; nothing is formatted until ring_trace_dump().
+ */
+
+#ifndef RING_TRACE_H
+#define RING_TRACE_H
+
+#include <stdint.h>
+
+// Trace levels.
+#define RING_TRACE_OFF 0
+#define RING_TRACE_ERROR 1
+#define RING_TRACE_ALL 2
+
+#ifndef RING_TRACE_LEVEL
+#define RING_TRACE_LEVEL RING_TRACE_OFF
+#endif
+
+// Number of records kept. Must be a power of 2.
+#ifndef RING_TRACE_LEN
+#define RING_TRACE_LEN 256
+#endif
+
+// Trace event ids.
+#define RING_EV_INSERT 1 // byte inserted, Index = Ini after insert
+#define RING_EV_REMOVE 2 // byte removed, Index = Outi after remove
+#define RING_EV_FULL 3   // insert failed, Index = Ini
+#define RING_EV_EMPTY 4  // remove failed, Index = Outi
+
+typedef struct
+{
+    uint32_t Index; // low 32 bits of the ring index
+    uint8_t Event;
+    char Data;
+} ring_trace_rec_t;
+
+void ring_trace(uint8_t event, uint32_t index, char data);
+int ring_trace_snapshot(ring_trace_rec_t *recs, int max);
+void ring_trace_dump(void);
+
+#if RING_TRACE_LEVEL >= RING_TRACE_ALL
+#define RING_TRACE(event, index, data) ring_trace((event), (index), (data))
+#else
+#define RING_TRACE(event, index, data) ((void)0)
+#endif
+
+#if RING_TRACE_LEVEL >= RING_TRACE_ERROR
+#define RING_TRACE_ERR(event, index, data) ring_trace((event), (index), (data))
+#else
+#define RING_TRACE_ERR(event, index, data) ((void)0)
+#endif
+
+#endif
@@ -0,0 +1,136 @@
+/*******************************************************************************
+ *
+ * Copyright (C) 2026 by the ring buffer contributors
+ *
+ ******************************************************************************/
+
+/*
+ * @file ring_typed.h
+ * @brief Macro-generated rings of any element type.
+ *
+ * @date October 16, 2026
+ *
+ * RING_TYPED(name, T) at file scope declares name_t, a ring of T with the same
+ * layout and SPSC rules as ring_t (see ring.h), and these functions:
+ *   name_t* name_init(size_t length)           length must be a power of 2
+ *   int name_insert(name_t *ring, const T *data)
+ *   int name_remove(name_t *ring, T *data)
+ *   size_t name_insert_n(name_t *ring, const T *src, size_t n)
+ *   size_t name_remove_n(name_t *ring, T *dst, size_t n)
+ *   size_t name_entries(name_t *ring)
+ *   void name_clean(name_t *ring)
+ * Lengths and counts are in elements, and whole elements are copied, so
+ * structs need no serializing. Example:
+ *   typedef struct { uint32_t ticks; uint16_t id; } event_t;
+ *   RING_TYPED(event_ring, event_t)
+ */
+
+#ifndef RING_TYPED_H
+#define RING_TYPED_H
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ring.h"
+
+#define RING_TYPED(name, T)                                                    \
+typedef struct                                                                 \
+{                                                                              \
+    T *Buffer;                                                                 \
+    size_t Length;                                                             \
+    size_t Adj_Len;                                                            \
+    _Alignas(RING_CACHE_LINE) atomic_size_t Ini;                               \
+    size_t Outi_Cache;                                                         \
+    _Alignas(RING_CACHE_LINE) atomic_size_t Outi;                              \
+    size_t Ini_Cache;                                                          \
+} name##_t;                                                                    \
+                                                                               \
+static inline name##_t* name##_init(size_t length)                             \
+{                                                                              \
+    if (!((length != 0) && !(length & (length - 1))))                          \
+    {                                                                          \
+        printf(#name "_init(): ERROR: Length of ring must be a power of 2.\n");\
+        exit(EXIT_FAILURE);                                                    \
+    }                                                                          \
+    name##_t *ring = aligned_alloc(RING_CACHE_LINE, sizeof(name##_t));         \
+    if (ring == NULL) { exit(EXIT_FAILURE); }                                  \
+    ring->Buffer = malloc(length * sizeof(T));                                 \
+    if (ring->Buffer == NULL) { exit(EXIT_FAILURE); }                          \
+    ring->Length = length;                                                     \
+    ring->Adj_Len = length - 1;                                                \
+    atomic_init(&ring->Ini, 0);                                                \
+    atomic_init(&ring->Outi, 0);                                               \
+    ring->Outi_Cache = 0;                                                      \
+    ring->Ini_Cache = 0;                                                       \
+    return ring;                                                               \
+}                                                                              \
+                                                                               \
+static inline size_t name##_insert_n(name##_t *ring, const T *src, size_t n)   \
+{                                                                              \
+    size_t ini = atomic_load_explicit(&ring->Ini, memory_order_relaxed);       \
+    size_t space = ring->Length - (ini - ring->Outi_Cache);                    \
+    if (space < n)                                                             \
+    {                                                                          \
+        ring->Outi_Cache = atomic_load_explicit(&ring->Outi,                   \
+                                                memory_order_acquire);         \
+        space = ring->Length - (ini - ring->Outi_Cache);                       \
+    }                                                                          \
+    if (n > space) { n = space; }                                              \
+    if (n == 0) { return 0; }                                                  \
+    size_t start = ini & ring->Adj_Len;                                        \
+    size_t first = ring->Length - start;                                       \
+    if (first > n) { first = n; }                                              \
+    memcpy(ring->Buffer + start, src, first * sizeof(T));                      \
+    memcpy(ring->Buffer, src + first, (n - first) * sizeof(T));                \
+    atomic_store_explicit(&ring->Ini, ini + n, memory_order_release);          \
+    return n;                                                                  \
+}                                                                              \
+                                                                               \
+static inline size_t name##_remove_n(name##_t *ring, T *dst, size_t n)         \
+{                                                                              \
+    size_t outi = atomic_load_explicit(&ring->Outi, memory_order_relaxed);     \
+    size_t avail = ring->Ini_Cache - outi;                                     \
+    if (avail < n)                                                             \
+    {                                                                          \
+        ring->Ini_Cache = atomic_load_explicit(&ring->Ini,                     \
+                                               memory_order_acquire);          \
+        avail = ring->Ini_Cache - outi;                                        \
+    }                                                                          \
+    if (n > avail) { n = avail; }                                              \
+    if (n == 0) { return 0; }                                                  \
+    size_t start = outi & ring->Adj_Len;                                       \
+    size_t first = ring->Length - start;                                       \
+    if (first > n) { first = n; }                                              \
+    memcpy(dst, ring->Buffer + start, first * sizeof(T));                      \
+    memcpy(dst + first, ring->Buffer, (n - first) * sizeof(T));                \
+    atomic_store_explicit(&ring->Outi, outi + n, memory_order_release);        \
+    return n;                                                                  \
+}                                                                              \
+                                                                               \
+static inline int name##_insert(name##_t *ring, const T *data)                 \
+{                                                                              \
+    return name##_insert_n(ring, data, 1);                                     \
+}                                                                              \
+                                                                               \
+static inline int name##_remove(name##_t *ring, T *data)                       \
+{                                                                              \
+    return name##_remove_n(ring, data, 1);                                     \
+}                                                                              \
+                                                                               \
+static inline size_t name##_entries(name##_t *ring)                            \
+{                                                                              \
+    size_t outi = atomic_load_explicit(&ring->Outi, memory_order_acquire);     \
+    size_t ini = atomic_load_explicit(&ring->Ini, memory_order_acquire);       \
+    return (ini - outi);                                                       \
+}                                                                              \
+                                                                               \
+static inline void name##_clean(name##_t *ring)                                \
+{                                                                              \
+    free(ring->Buffer);                                                        \
+    ring->Buffer = NULL;                                                       \
+    free(ring);                                                                \
+}
+
+#endif
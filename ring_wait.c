@@ -0,0 +1,178 @@
+/*******************************************************************************
+ *
+ * Copyright (C) 2026 by the ring buffer contributors
+ *
+ ******************************************************************************/
+
+/*
+ * @file ring_wait.c
+ * @brief Library definitions for blocking ring waits on a futex (Linux only).
+ *
+ * @date October 16, 2026
+ *
+ * NOTES:
+ * A waiter sets its Waiting flag and then rechecks the ring. A notifier
+ * publishes its index and then checks the flag. A seq_cst fence on each side
+ * (Dekker style) guarantees at least one of them sees the other. So either the
+ * waiter sees the new data/space, or the notifier sees the flag and bumps the
+ * sequence. The waiter read the sequence before setting its flag, so the
+ * futex wait then returns at once instead of missing the wakeup.
+ */
+
+#include "ring_wait.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+static void futex_wait(atomic_uint *addr, unsigned val)
+{
+    syscall(SYS_futex, addr, FUTEX_WAIT_PRIVATE, val, NULL, NULL, 0);
+}
+
+static void futex_wake(atomic_uint *addr)
+{
+    syscall(SYS_futex, addr, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0);
+}
+
+// Tell the CPU we are in a spin loop.
+static inline void spin_pause(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ volatile ("yield");
+#endif
+}
+
+// Wake one side if it is asleep (or about to sleep) on seq.
+static void wake_if_waiting(atomic_uint *seq, atomic_int *waiting)
+{
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(waiting, memory_order_relaxed))
+    {
+        atomic_fetch_add_explicit(seq, 1, memory_order_release);
+        futex_wake(seq);
+    }
+}
+
+// On_Insert hook: the producer published data.
+static void on_insert(ring_t *ring)
+{
+    ring_wait_t *w = ring->Notify_Ctx;
+    wake_if_waiting(&w->Data_Seq, &w->Consumer_Waiting);
+}
+
+// On_Remove hook: the consumer freed space.
+static void on_remove(ring_t *ring)
+{
+    ring_wait_t *w = ring->Notify_Ctx;
+    wake_if_waiting(&w->Space_Seq, &w->Producer_Waiting);
+}
+
+// Attach a wait context to ring; spin_budget is the number of polls before a
+// wait sleeps. Call before the ring is shared. Returns 1 on success.
+int ring_wait_attach(ring_t *ring, int spin_budget)
+{
+    // Verify.
+    if (!is_ring_valid(ring)) { exit(EXIT_FAILURE); }
+    if (ring->On_Insert != NULL || ring->On_Remove != NULL)
+    {
+        printf("ring_wait_attach(): ERROR: Ring already has hooks.\n");
+        return 0;
+    }
+
+    ring_wait_t *w = aligned_alloc(RING_CACHE_LINE, sizeof(ring_wait_t));
+    if (w == NULL) { return 0; }
+    atomic_init(&w->Data_Seq, 0);
+    atomic_init(&w->Consumer_Waiting, 0);
+    atomic_init(&w->Space_Seq, 0);
+    atomic_init(&w->Producer_Waiting, 0);
+    w->Spin_Budget = spin_budget;
+
+    ring->Notify_Ctx = w;
+    ring->On_Insert = on_insert;
+    ring->On_Remove = on_remove;
+    return 1;
+}
+
+// Remove the wait context. Nobody may be waiting on the ring.
+void ring_wait_detach(ring_t *ring)
+{
+    // Verify.
+    if (!is_ring_valid(ring)) { exit(EXIT_FAILURE); }
+
+    ring->On_Insert = NULL;
+    ring->On_Remove = NULL;
+    free(ring->Notify_Ctx);
+    ring->Notify_Ctx = NULL;
+}
+
+// Block until ready(ring) is true: spin, then sleep on seq with waiting set.
+static void wait_until(ring_t *ring, int (*ready)(ring_t *ring),
+                       atomic_uint *seq, atomic_int *waiting)
+{
+    ring_wait_t *w = ring->Notify_Ctx;
+
+    for (int i = 0; i < w->Spin_Budget; i++)
+    {
+        if (ready(ring)) { return; }
+        spin_pause();
+    }
+
+    for (;;)
+    {
+        unsigned val = atomic_load_explicit(seq, memory_order_acquire);
+        atomic_store_explicit(waiting, 1, memory_order_relaxed);
+        atomic_thread_fence(memory_order_seq_cst);
+        if (ready(ring)) { break; }
+        futex_wait(seq, val);
+    }
+    atomic_store_explicit(waiting, 0, memory_order_relaxed);
+}
+
+static int is_readable(ring_t *ring)
+{
+    return entries(ring) > 0;
+}
+
+static int is_writable(ring_t *ring)
+{
+    return entries(ring) < ring->Length;
+}
+
+// Consumer: block until the ring has at least one entry.
+void ring_wait_readable(ring_t *ring)
+{
+    ring_wait_t *w = ring->Notify_Ctx;
+    wait_until(ring, is_readable, &w->Data_Seq, &w->Consumer_Waiting);
+}
+
+// Producer: block until the ring has room for at least one entry.
+void ring_wait_writable(ring_t *ring)
+{
+    ring_wait_t *w = ring->Notify_Ctx;
+    wait_until(ring, is_writable, &w->Space_Seq, &w->Producer_Waiting);
+}
+
+// Blocking ring_remove(). Returns 1 once a char has been removed.
+int ring_remove_wait(ring_t *ring, char *data)
+{
+    while (!ring_remove(ring, data))
+    {
+        ring_wait_readable(ring);
+    }
+    return 1;
+}
+
+// Blocking ring_insert(). Returns 1 once the char has been inserted.
+int ring_insert_wait(ring_t *ring, char data)
+{
+    while (!ring_insert(ring, data))
+    {
+        ring_wait_writable(ring);
+    }
+    return 1;
+}
@@ -0,0 +1,51 @@
+/*******************************************************************************
+ *
+ * Copyright (C) 2026 by the ring buffer contributors
+ *
+ ******************************************************************************/
+
+/*
+ * @file ring_wait.h
+ * @brief Library declarations for blocking ring waits on a futex (Linux only).
+ *
+ * @date October 16, 2026
+ *
+ * ring_wait_attach() gives a ring a wait context and installs its
+ * On_Insert/On_Remove hooks. After that, a consumer can block until there is
+ * data and a producer until there is space. Each wait first spins for
+ * Spin_Budget polls, then sleeps on a futex. The other side only makes the
+ * wake syscall when someone is actually asleep. Any ring.h insert/remove
+ * function wakes the other side, so blocking and non-blocking calls can be
+ * mixed.
+ */
+
+#ifndef RING_WAIT_H
+#define RING_WAIT_H
+
+#include <stdatomic.h>
+#include "ring.h"
+
+// Default number of polls before sleeping.
+#define RING_WAIT_SPIN 1000
+
+typedef struct
+{
+    // Consumer sleeps on Data_Seq; the producer bumps it to wake it.
+    _Alignas(RING_CACHE_LINE) atomic_uint Data_Seq;
+    atomic_int Consumer_Waiting;
+
+    // Producer sleeps on Space_Seq; the consumer bumps it to wake it.
+    _Alignas(RING_CACHE_LINE) atomic_uint Space_Seq;
+    atomic_int Producer_Waiting;
+
+    int Spin_Budget;
+} ring_wait_t;
+
+int ring_wait_attach(ring_t *ring, int spin_budget);
+void ring_wait_detach(ring_t *ring);
+void ring_wait_readable(ring_t *ring);
+void ring_wait_writable(ring_t *ring);
+int ring_remove_wait(ring_t *ring, char *data);
+int ring_insert_wait(ring_t *ring, char data);
+
+#endif
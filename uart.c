@@ -60,6 +60,7 @@ RDRF (Receive Data Register Full flag (set in UART0_S1):
 #include "led.h"
 #include "MKL25Z4.h"
 #include <stdio.h> // for sprintf
+#include <string.h> // for strlen
 
 //#define ECHO_RX_ONLY // echo char with no tx interrupts
 //#define ECHO_RX_TX // echo char with both rx and tx interrupts
@@ -76,6 +77,10 @@ int num_unique_chars;
 ring_t *ring_rx;
 ring_t *ring_tx;
 
+// Ring storage lives in .bss; no heap is used.
+RING_DEFINE(uart_rx, RING_BUFF_LEN)
+RING_DEFINE(uart_tx, RING_BUFF_LEN)
+
 void init_ascii_table()
 {
     for (int i = 0; i < NUM_SYMBOLS; i++)
@@ -86,11 +91,11 @@ void init_ascii_table()
 
 void uart_init_buff()
 {
-    // Initialize ring buffer for receiving chars from host serial terminal.
-    ring_rx = init(RING_BUFF_LEN);
+    // Ring buffer for receiving chars from host serial terminal.
+    ring_rx = &uart_rx_ring;
 
-    // Initialize ring buffer for transmitting chars from device UART.
-    ring_tx = init(RING_BUFF_LEN);
+    // Ring buffer for transmitting chars from device UART.
+    ring_tx = &uart_tx_ring;
 }
 
 void uart_init()
@@ -225,65 +230,65 @@ char uart_receive_blocking()
     return uart_receive();
 }
 
-void generate_tx_ring_report()
+int uart_transmit_ring(ring_t *ring)
 {
-    // Insert table title into tx ring.
-    const char *p = table_title;
-    while (*p != '\0')
+    // Transmit chars straight out of the ring's storage while the UART can
+    // take them. Only the chars actually transmitted are consumed.
+    char *p;
+    size_t span;
+    while ((span = ring_peek(ring, &p)) > 0)
     {
- 	insert(ring_tx, *p);
-	p++;
+        size_t sent = 0;
+        while (sent < span && uart_can_transmit())
+        {
+            uart_transmit(p[sent++]);
+        }
+        ring_consume(ring, sent);
+
+        if (sent < span)
+        {
+            return 0; // UART busy, rest is sent on the next interrupt
+        }
     }
 
+    return 1; // ring drained
+}
+
+void generate_tx_ring_report()
+{
+    // Insert table title into tx ring.
+    insert_n(ring_tx, table_title, strlen(table_title));
+
     // Insert chars that have a count > 0 into tx ring.
     for (int i = 0; i < NUM_SYMBOLS; i++)
     {
  	if (ascii[i] != 0)
 	{
-	    // Get the char string representation of the ascii[i] integer value.
-	    // Ex: If the number of 'a' chars received is 12, we want to
-            // transmit the value 12. sprintf is used to convert the dec = 12
-            // value to a char string, and then the chars '1' and '2' are
-            // inserted into the tx buffer.
-    	    char count_as_char[MAX_COUNT_DIGITS + 1]; // + 1 for '\0' char
-	    int num_digits = sprintf(count_as_char, "%d", ascii[i]);
-
-   	    // Insert the char and its count, formatted.
 	    // Each line is in the format: char - #\r\n (ex. b - 12).
-            insert(ring_tx, (char)i); // the char from uart
-            insert(ring_tx, ' ');     // a space
-            insert(ring_tx, '-');     // a dash
-            insert(ring_tx, ' ');     // a space
-            for (int j = 0; j < num_digits; j++) // the char count
-            {
-                insert(ring_tx, count_as_char[j]);
-            }
-            insert(ring_tx, '\r');    // needed for new line
-            insert(ring_tx, '\n');    // new line
+	    // Format the row straight into the tx ring when there is a long
+	    // enough span before the wrap point, otherwise stage and copy it.
+	    char *p;
+	    if (ring_reserve(ring_tx, MAX_ROW_LEN + 1, &p) > MAX_ROW_LEN)
+	    {
+	        ring_commit(ring_tx, sprintf(p, "%c - %d\r\n", (char)i, ascii[i]));
+	    }
+	    else
+	    {
+	        char row[MAX_ROW_LEN + 1]; // + 1 for '\0' char
+	        int row_len = sprintf(row, "%c - %d\r\n", (char)i, ascii[i]);
+	        insert_n(ring_tx, row, row_len);
+	    }
  	}
     }
 }
 
 void generate_unique_chars_report()
 {
-    char count_as_char[MAX_COUNT_DIGITS + 1]; // + 1 for '\0' char
-    int num_digits = sprintf(count_as_char, "%d", num_unique_chars);
-
-    // Insert unique chars title into tx ring.
+    // Insert unique chars title and count into tx ring in one call.
     // Line is in the format: unique chars: #
-    const char *p = unique_title;
-    while (*p != '\0')
-    {
- 	insert(ring_tx, *p);
-	p++;
-    }
-    insert(ring_tx, ' ');
-    for (int j = 0; j < num_digits; j++) // the char count
-    {
-    	insert(ring_tx, count_as_char[j]);
-    }
-    insert(ring_tx, '\r');
-    insert(ring_tx, '\n');
+    char row[MAX_ROW_LEN + 1]; // + 1 for '\0' char
+    int row_len = sprintf(row, "%s %d\r\n", unique_title, num_unique_chars);
+    insert_n(ring_tx, row, row_len);
 }
 
 void UART0_IRQHandler(void)
@@ -299,7 +304,7 @@ void UART0_IRQHandler(void)
     	char c = uart_receive();
 
     	// Insert char into app ring.
-    	insert(ring_rx, c);
+    	uart_rx_insert(c);
     }
 
     // Device UART transmit char to host serial terminal.
@@ -309,7 +314,7 @@ void UART0_IRQHandler(void)
     	{
       	    // Remove char from rx ring.
     	    char c;
-            my_remove(ring_rx, &c);
+            uart_rx_remove(&c);
 
             // Transmit char to host serial terminal.
             uart_transmit(c);
@@ -326,16 +331,16 @@ void UART0_IRQHandler(void)
     	char rc = uart_receive();
 
     	// Insert char into rx ring.
-    	insert(ring_rx, rc);
+    	uart_rx_insert(rc);
 
         if (entries(ring_rx) > 0)
     	{
     	    // Remove a char from rx ring.
     	    char tc;
-            my_remove(ring_rx, &tc);
+            uart_rx_remove(&tc);
 
             // Add that char to tx ring.
-            insert(ring_tx, tc);
+            uart_tx_insert(tc);
 
             // Enable transmit interrupts.
             UART0->C2 |= UART0_C2_TIE(1);
@@ -344,19 +349,13 @@ void UART0_IRQHandler(void)
     // Device UART transmit char to host serial terminal.
     else if ((UART0->C2 & UART0_C2_TCIE(1)) == 0)
     {
-        while (uart_can_transmit() && entries(ring_tx) > 0)
-    	{
-    	    // Remove char from tx ring.
-    	    char tc;
-            my_remove(ring_tx, &tc);
-
-            // Transmit char to host serial terminal.
-            uart_transmit(tc);
+        // Transmit chars from the tx ring to host serial terminal. Disable
+        // transmit interrupts once the ring is drained so not constantly
+        // entering the interrupt handler.
+        if (uart_transmit_ring(ring_tx))
+        {
+            UART0->C2 &= ~UART_C2_TIE(1);
         }
-
-        // Disable transmit interrupts so not constantly entering the interrupt
-        // handler.
-        UART0->C2 &= ~UART_C2_TIE(1);
     }
 #endif
 
@@ -369,18 +368,18 @@ void UART0_IRQHandler(void)
     	char rc = uart_receive();
 
     	// Insert char into rx ring.
-    	int ret = insert(ring_rx, rc);
+    	int ret = uart_rx_insert(rc);
 
         if (ret && entries(ring_rx) > 0)
     	{
     	    // Remove a char from rx ring.
     	    char tc;
-            int ret = my_remove(ring_rx, &tc);
+            int ret = uart_rx_remove(&tc);
 
             if (ret)
             {
             	// Increment count for char tc.
-            	ascii[(int)rc]++;
+            	ascii[(unsigned char)rc]++;
 
             	// Add char to tx ring. The tx ring is formatted as a table.
             	generate_tx_ring_report();
@@ -394,20 +393,12 @@ void UART0_IRQHandler(void)
     else if ((UART0->C2 & UART0_C2_TCIE(1)) == 0)
     {
         // Transmit tx ring table to host serial terminal from device UART.
-        while (entries(ring_tx) > 0)
+        // Disable transmit interrupts once the ring is drained so not
+        // constantly entering the interrupt handler.
+        if (uart_transmit_ring(ring_tx))
         {
-            // Remove char from the tx ring.
-            char tx_c;
-            int ret = my_remove(ring_tx, &tx_c);
-            if (ret && uart_can_transmit())
-            {
-                uart_transmit(tx_c);
-            }
+            UART0->C2 &= ~UART_C2_TIE(1);
         }
-
-        // Disable transmit interrupts so not constantly entering the interrupt
-        // handler.
-        UART0->C2 &= ~UART_C2_TIE(1);
     }
 #endif
 
@@ -420,7 +411,7 @@ void UART0_IRQHandler(void)
     	char rc = uart_receive();
 
     	// Increment count for received char rc.
-    	ascii[(int)rc]++;
+    	ascii[(unsigned char)rc]++;
 
         // Generate a report. The tx ring contains a count of received chars and
     	// is formatted as a simple table.
@@ -438,20 +429,12 @@ void UART0_IRQHandler(void)
     else if ((UART0->C2 & UART0_C2_TCIE(1)) == 0)
     {
         // Transmit tx ring table to host serial terminal from device UART.
-        while (entries(ring_tx) > 0)
+        // Disable transmit interrupts once the ring is drained so not
+        // constantly entering the interrupt handler.
+        if (uart_transmit_ring(ring_tx))
         {
-            // Remove char from the tx ring.
-            char tc;
-            int ret = my_remove(ring_tx, &tc);
-            if (ret && uart_can_transmit())
-            {
-                uart_transmit(tc);
-            }
+            UART0->C2 &= ~UART_C2_TIE(1);
         }
-
-        // Disable transmit interrupts so not constantly entering the interrupt
-        // handler.
-        UART0->C2 &= ~UART_C2_TIE(1);
     }
 #endif
     // Renable UART0 interrupts.
@@ -19,7 +19,9 @@
 // Constants.
 #define RING_BUFF_LEN 256 // must be a power of 2
 #define NUM_SYMBOLS 256 // num ASCII chars
-#define MAX_COUNT_DIGITS 3 // max number of places (digits) for char count
+#define MAX_COUNT_DIGITS 10 // max number of places (digits) for char count
+#define MAX_TITLE_LEN 32 // longest report title, including surrounding CR/LF
+#define MAX_ROW_LEN (MAX_TITLE_LEN + MAX_COUNT_DIGITS + 4) // longest report row
 
 // Declare static (global) variables.
 extern const char *table_title;
@@ -39,6 +41,7 @@ void uart_init_interrupt();
 int uart_can_transmit();
 void uart_transmit(char c);
 void uart_transmit_blocking(char c);
+int uart_transmit_ring(ring_t *ring);
 int uart_can_receive();
 char uart_receive();
 char uart_receive_blocking();